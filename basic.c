@@ -0,0 +1,4055 @@
+/*
+	TOYOSHIKI Tiny BASIC for Linux
+	(C)2015 Tetsuya Suzuki
+	Interpreter, built into ttbasic and libttbasic
+*/
+
+/*
+TO DO:
+The following variables use pointer arithmetic, which is probably a bad idea if
+you want to convert the code to another language:
+  current_icode
+  current_line
+  ip
+  line_pointer
+  keyword_pointer
+  character_in_line_buffer_pointer
+  top_of_command_line
+*/
+
+#define _GNU_SOURCE // for SIGEV_THREAD_ID
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ttbasic.h"
+
+// Compiler requires description
+
+// TOYOSHIKI TinyBASIC symbols
+// TO-DO Rewrite defined values to fit your machine as needed
+#define SIZE_LINE_COMMAND 256 // Command line buffer length + NULL
+#define SIZE_IBUFFER 512	  // i-code conversion buffer size
+#define SIZE_LIST_BUFFER 1024 // List buffer size at start, doubled as needed
+#define SIZE_LIST_MAX (64 * 1024 * 1024) // List buffer size at most
+#define SIZE_LINE_HEADER 4	  // Line length(2 bytes) and line number(2 bytes)
+#define SIZE_ARRAY_AREA 64	// Array area size by default
+#define SIZE_ARRAY_MAX TB_ARRAY_MAX // Array area size at most
+#define SIZE_GOSUB_STACK 6	// GOSUB stack size(2/nest)
+#define SIZE_LSTK 3			  // FOR stack size(frames, 1 is spare)
+#define SIZE_LINE_MIN 6		  // A stored line takes header, 1 i-code and I_EOL at least
+#define SIZE_OUTPUT_BUFFER 65536			   // Output buffer size
+#define SIZE_INPUT_BUFFER 4096				   // Input buffer size (input callback only)
+#define SIZE_BYTECODE_AREA 4096			   // Bytecode area size at start, doubled as needed
+#define SIZE_BYTECODE_STACK 32				   // Bytecode evaluation stack size
+#define SIZE_SITE_TABLE 64					   // Site table entries at start (power of 2), doubled as needed
+#define SIZE_KEYWORD_TRIE 128				   // Keyword trie nodes (keyword characters + root)
+#define SIZE_LINE_NUMBERS 32768			   // Line numbers 0 to 32767, for profile records
+#define SIZE_SAMPLE_TABLE 4096				   // Sample table entries (stacks told apart)
+#define SAMPLE_INTERVAL 1000				   // Sampling interval by default (microseconds)
+#define SIZE_TRACE_BUFFER 4096				   // Trace ring buffer entries (power of 2)
+#define SIZE_TRACE_DUMP 8					   // Trace entries printed after an error
+
+#define ASCII_SPACE 32
+#define ASCII_MAX_CHARACTER 127
+#define ASCII_BACKSPACE 8
+#define ASCII_TAB 9
+#define ASCII_CARRIAGE_RETURN 13
+
+#define MAX_BYTE_VALUE 255
+#define BITS_IN_BYTE 8
+
+// Dispatch
+// With GCC or Clang, the statement loop and the bytecode loop jump to the
+// next handler through a table of labels (direct threading).
+// Define SWITCH_DISPATCH to use the portable switch instead.
+#if defined(__GNUC__) && !defined(SWITCH_DISPATCH)
+#define THREADED_DISPATCH
+#endif
+
+// FOR loop frame
+// NEXT continues while (unsigned short)(counter - low) <= span, that is
+// counter <= TO for positive STEP, counter >= TO for negative STEP,
+// and always for STEP 0
+struct for_frame
+{
+	unsigned char *line;  // line pointer
+	unsigned char *icode; // i-code pointer after FOR statement
+	short *counter;		  // loop counter variable
+	short step;			  // STEP value
+	unsigned short low;	  // low end of continue range
+	unsigned short span;  // width of continue range
+	unsigned char index;  // variable index
+};
+
+// Sampled stack
+// The lines of the GOSUBs under way, outermost first, and the current line
+struct sample_record
+{
+	short line[SIZE_GOSUB_STACK / 2 + 1]; // line numbers
+	unsigned char depth;				  // line number count
+	unsigned long count;				  // samples, 0 for free entry
+};
+
+// Trace entry
+struct trace_record
+{
+	short line;			 // line number, 0 for a direct command
+	unsigned char icode; // statement i-code
+};
+
+// Line record in the load area
+struct load_record
+{
+	short number;		 // line number
+	unsigned int offset; // offset in load area
+};
+
+// Site table entry
+struct site_entry
+{
+	unsigned int key;	// i-code offset + 1, 0 for free entry
+	unsigned int value; // never 0
+};
+
+// Site table
+// Values kept for the few i-code sites that need them (branch links,
+// compiled expressions), by offset in the list area
+struct site_table
+{
+	struct site_entry *entry; // open addressed, linear probing
+	unsigned int size;		  // allocated entries, power of 2 or 0
+	unsigned int count;		  // entries in use
+};
+
+// Interpreter context
+// Everything one interpreter changes is here, and every function that
+// needs it takes it as tb. Contexts share only the read-only tables and
+// the terminal, so each one can run on its own thread.
+struct tb_context
+{
+	// Options
+	unsigned char engine;	  // Execution engine
+	unsigned char batch_mode; // Run without banner, prompt, echo and OK
+	unsigned char perf_counters; // Report hardware counters after every RUN
+
+	// Input and output
+	tb_output_callback output;				// Output, or NULL for standard output
+	void *output_user;						// Passed to output
+	tb_input_callback input;				// Input, or NULL for standard input
+	void *input_user;						// Passed to input
+	char output_buffer[SIZE_OUTPUT_BUFFER]; // Output buffer
+	unsigned int output_length;				// Output buffer length
+	unsigned char output_flush_policy;		// Flush policy
+	char input_buffer[SIZE_INPUT_BUFFER];	// Input buffer
+	unsigned int input_length;				// Input buffer length
+	unsigned int input_position;			// Input buffer read position
+
+	// Run by steps
+	unsigned long statement_count; // Statements run since created
+	unsigned char running;		   // A run by tb_step is under way
+	unsigned long step_left;	   // Statements left to run, 0 for no limit
+	unsigned char step_ended;	   // The run stopped as no statement is left
+
+	// RAM mapping
+	unsigned char err;										 // Error message index
+	unsigned int random_seed;								 // RND state
+	char command_line_buffer[SIZE_LINE_COMMAND];			 // Command line buffer
+	unsigned char icode_conversion_buffer[SIZE_IBUFFER * 2]; // i-code conversion buffer (with original i-code)
+	short variable_area[26];								 // Variable area
+	short *array_area;										 // Array area
+	unsigned short array_area_size;							 // Array area size (elements)
+	unsigned char array_area_mapped;						 // Array area is mapped from a file
+	unsigned char *list_area;								 // List area
+	unsigned int list_area_size;							 // List area allocated size
+	unsigned int list_length;								 // List area used length (without end of list)
+	unsigned char *current_line;							 // Pointer current line
+	unsigned char *current_icode;							 // Pointer current Intermediate code
+	unsigned char *gosub_stack[SIZE_GOSUB_STACK];			 // GOSUB stack
+	unsigned char gosub_stack_index;						 // GOSUB stack index
+	struct for_frame for_stack[SIZE_LSTK];					 // FOR stack
+	unsigned char for_stack_index;							 // FOR stack index
+
+	// Line index and branch links
+	short *line_index_number;			// Line index, line numbers in list order
+	unsigned int *line_index_offset;	// Line index, offsets in list area (+1 for end of list)
+	unsigned int line_index_count;		// Line index entry count
+	struct site_table branch_links;		// Resolved GOTO/GOSUB target offset + 1 by i-code offset
+	unsigned char branch_links_resolved; // Branch links are resolved
+
+	// Peephole optimizer
+	unsigned char icode_optimize_buffer[SIZE_IBUFFER * 2]; // Optimized i-code
+	unsigned char *optimize_icode;						   // Pointer to i-code in optimization
+	unsigned short optimize_length;						   // Optimized i-code length
+
+	// Batch load
+	unsigned char *load_area;		 // Load area, line records in the order read
+	unsigned int load_area_size;	 // Load area allocated size
+	unsigned int load_length;		 // Load area used length
+	struct load_record *load_index; // Records in load area
+	unsigned int load_index_size;	 // Load index allocated entries
+	unsigned int load_count;		 // Record count
+	unsigned char load_sorted;		 // Records are in ascending line number order
+
+	// Bytecode engine
+	int *bytecode_area;						 // Bytecode area
+	unsigned int bytecode_area_size;		 // Bytecode area allocated size
+	unsigned int bytecode_length;			 // Bytecode area used length
+	struct site_table expression_cache;		 // Expression cache entry by i-code offset
+	unsigned char *compile_icode;			 // Pointer to i-code in compilation
+	unsigned char compile_depth;			 // Stack depth in compilation
+
+	// Counters, since created
+	unsigned long dispatch_count[MAX_BYTE_VALUE + 1]; // Statements dispatched by i-code
+	unsigned long line_search_count;				   // Line number searches
+	unsigned long line_probe_count;					   // Line index entries compared by searches
+	unsigned long expression_count;					   // Expressions evaluated
+	unsigned char gosub_stack_high;					   // GOSUB stack index high-water mark
+	unsigned char for_stack_high;					   // FOR stack index high-water mark
+	unsigned int list_length_high;					   // List area used length high-water mark
+
+	// Trace
+	unsigned char trace_on;								// TRON is in effect
+	unsigned long trace_count;							// Statements traced in this run
+	unsigned long trace_start;							// Trace count when this command or run began
+	struct trace_record trace_buffer[SIZE_TRACE_BUFFER]; // Last statements traced, a ring
+	const char *trace_file_name;						// File to write the trace to after a run, or NULL
+
+	// Sampler
+	const char *sample_file_name;		// Folded stacks file, or NULL for no sampling
+	long sample_interval;				// Sampling interval (microseconds)
+	struct sample_record *sample_table; // Samples by stack, hashed
+	unsigned long sample_dropped;		// Samples with no room in the table
+
+	// Profiler
+	unsigned long *profile_count;	  // Runs by line number, from PROFILE RUN
+	unsigned long long *profile_time; // Nanoseconds by line number
+};
+
+// Depending on device functions
+// TO-DO Rewrite these functions to fit your machine
+#define STR_EDITION "LINUX"
+
+// Terminal control
+
+static char c_kbhit(void)
+{
+	char c;
+	int f;
+
+	f = fcntl(STDIN_FILENO, F_GETFL, 0);
+	fcntl(STDIN_FILENO, F_SETFL, f | O_NONBLOCK);
+
+	c = getchar();
+
+	fcntl(STDIN_FILENO, F_SETFL, f);
+
+	if (c != EOF)
+	{
+		ungetc(c, stdin);
+		return 1;
+	}
+
+	return 0;
+}
+
+// Key-in watcher
+// The terminal raises SIGIO when key-in arrives, so that the interpreter
+// checks the flag instead of polling the terminal at every statement.
+// Pipes and files never raise it, so there is nothing to check.
+static volatile sig_atomic_t key_pending; // Key-in arrived
+static int stdin_file_flags;			   // Original file status flags
+
+static void c_sigio_handler(int signal_number)
+{
+	(void)signal_number;
+	key_pending = 1;
+}
+
+static void c_restore_key_watcher(void)
+{
+	fcntl(STDIN_FILENO, F_SETFL, stdin_file_flags);
+}
+
+static void c_init_key_watcher(void)
+{
+	struct sigaction action;
+
+	if (!isatty(STDIN_FILENO))
+		return;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = c_sigio_handler;
+	action.sa_flags = SA_RESTART;
+	sigaction(SIGIO, &action, NULL);
+
+	stdin_file_flags = fcntl(STDIN_FILENO, F_GETFL, 0);
+	fcntl(STDIN_FILENO, F_SETOWN, getpid());
+	fcntl(STDIN_FILENO, F_SETFL, stdin_file_flags | O_ASYNC);
+	atexit(c_restore_key_watcher);
+
+	key_pending = 1; // Check type-ahead once
+}
+
+// Output
+// Everything is written through one buffer. On a terminal it is flushed
+// at every line, for pipes and files only when it is full. It is always
+// flushed before input and after an error message.
+
+static void c_flush(struct tb_context *tb)
+{
+	unsigned int done;
+	ssize_t written;
+
+	if (tb->output)
+	{ // Given to the caller
+		if (tb->output_length)
+			tb->output(tb->output_user, tb->output_buffer, tb->output_length);
+		tb->output_length = 0;
+		return;
+	}
+	for (done = 0; done < tb->output_length; done += written)
+	{
+		written = write(STDOUT_FILENO, tb->output_buffer + done, tb->output_length - done);
+		if (written <= 0)
+			break; // Output closed, discard
+	}
+	tb->output_length = 0;
+}
+
+// AUTO looks at standard output only when it is written to
+static void c_init_output(struct tb_context *tb, unsigned char policy)
+{
+	if (policy == TB_FLUSH_AUTO)
+		policy = !tb->output && isatty(STDOUT_FILENO) ? TB_FLUSH_LINE : TB_FLUSH_BLOCK;
+	tb->output_flush_policy = policy;
+}
+
+static void c_putch(struct tb_context *tb, char c)
+{
+	tb->output_buffer[tb->output_length++] = c;
+	if (tb->output_length == SIZE_OUTPUT_BUFFER)
+		c_flush(tb);
+}
+
+static void c_write(struct tb_context *tb, const char *text, unsigned int len)
+{
+	unsigned int i;
+
+	if (tb->output_length + len > SIZE_OUTPUT_BUFFER)
+		c_flush(tb);
+	for (i = 0; i < len; i++)
+		tb->output_buffer[tb->output_length++] = text[i]; // never overflow, len is a line at most
+}
+
+// Get 1 character of input
+// Return EOF at the end
+static int c_getch(struct tb_context *tb)
+{
+	if (!tb->input)
+		return getchar();
+	if (tb->input_position == tb->input_length)
+	{ // Ask the caller for more
+		tb->input_length = tb->input(tb->input_user, tb->input_buffer, SIZE_INPUT_BUFFER);
+		tb->input_position = 0;
+		if (!tb->input_length)
+			return EOF;
+	}
+	return (unsigned char)tb->input_buffer[tb->input_position++];
+}
+
+#define KEY_ENTER 10
+static void newline(struct tb_context *tb)
+{
+	c_putch(tb, KEY_ENTER); // LF
+	if (tb->output_flush_policy == TB_FLUSH_LINE)
+		c_flush(tb);
+}
+
+// Return random number
+static short get_random_number(struct tb_context *tb, short value)
+{
+	return (rand_r(&tb->random_seed) % value) + 1;
+}
+
+// Prototypes (necessity minimum)
+static short i_the_parser(struct tb_context *tb);
+static void drop_expression_cache(struct tb_context *tb);
+static void image_put(unsigned char *p, unsigned int value, unsigned char len);
+
+// Keywords, in i-code order
+// KEYWORD is applied to each, for the table and the size of the trie
+#define KEYWORDS(KEYWORD)                                                           \
+	KEYWORD("GOTO") KEYWORD("GOSUB") KEYWORD("RETURN")                              \
+	KEYWORD("FOR") KEYWORD("TO") KEYWORD("STEP") KEYWORD("NEXT")                    \
+	KEYWORD("IF") KEYWORD("REM") KEYWORD("STOP")                                    \
+	KEYWORD("INPUT") KEYWORD("PRINT") KEYWORD("LET")                                \
+	KEYWORD(",") KEYWORD(";")                                                       \
+	KEYWORD("-") KEYWORD("+") KEYWORD("*") KEYWORD("/") KEYWORD("(") KEYWORD(")")   \
+	KEYWORD(">=") KEYWORD("#") KEYWORD(">") KEYWORD("=") KEYWORD("<=") KEYWORD("<") \
+	KEYWORD("@") KEYWORD("RND") KEYWORD("ABS") KEYWORD("SIZE")                      \
+	KEYWORD("LIST") KEYWORD("RUN") KEYWORD("NEW") KEYWORD("SYSTEM")                 \
+	KEYWORD("PROFILE") KEYWORD("STATS")                                             \
+	KEYWORD("TRON") KEYWORD("TROFF") KEYWORD("SAVE") KEYWORD("LOAD")
+#define KEYWORD_STRING(name) name,
+#define KEYWORD_SIZE(name) +sizeof(name)
+
+// Keyword table
+static const char *keyword_table[] = {KEYWORDS(KEYWORD_STRING)};
+
+// i-code(Intermediate code) assignment
+enum
+{
+	I_GOTO,   // 0 GOTO
+	I_GOSUB,  // 1
+	I_RETURN, // 2
+	I_FOR,	// 3
+	I_TO,	 // 4
+	I_STEP,   // 5
+	I_NEXT,   // 6
+	I_IF,	 // 7
+	I_REM,	// 8
+	I_STOP,   // 9
+	I_INPUT,  // 10
+	I_PRINT,  // 11 PRINT
+	I_LET,	// 12
+	I_COMMA,  // 13
+	I_SEMI,   // 14 Semicolon
+	I_MINUS,  // 15
+	I_PLUS,   // 16
+	I_MUL,	// 17
+	I_DIV,	// 18
+	I_OPEN,   // 19
+	I_CLOSE,  // 20
+	I_GTE,	// 21
+	I_SHARP,  // 22
+	I_GT,	 // 23
+	I_EQ,	 // 24
+	I_LTE,	// 25
+	I_LT,	 // 26
+	I_ARRAY,  // 27
+	I_RND,	// 28
+	I_ABS,	// 29
+	I_SIZE,   // 30
+	I_LIST,   // 31
+	I_RUN,	// 32
+	I_NEW,	// 33
+	I_SYSTEM, // 34
+	I_PROFILE, // 35
+	I_STATS,  // 36
+	I_TRON,   // 37
+	I_TROFF,  // 38
+	I_SAVE,   // 39
+	I_LOAD,   // 40
+	I_NUM,	// 41
+	I_VAR,	// 42 Variable
+	I_STR,	// 43
+	I_EOL	 // 44
+};
+
+// Keyword count
+#define SIZE_KEYWORD_TABLE (sizeof(keyword_table) / sizeof(const char *))
+
+// The trie takes the root and a node per keyword character at most, and
+// nodes are numbered in unsigned char
+_Static_assert(1 KEYWORDS(KEYWORD_SIZE) - SIZE_KEYWORD_TABLE <= SIZE_KEYWORD_TRIE, "SIZE_KEYWORD_TRIE is too small for the keywords");
+_Static_assert(SIZE_KEYWORD_TRIE <= MAX_BYTE_VALUE + 1, "SIZE_KEYWORD_TRIE is too large for unsigned char nodes");
+
+// Keyword trie
+// Built from keyword_table at start. Each node has an edge per ASCII
+// character, with lower case letters sharing the upper case edge, and the
+// i-code of the keyword ending there. Where several keywords match, the one
+// first in keyword_table wins, as in the table search it replaces.
+static unsigned char keyword_trie_next[SIZE_KEYWORD_TRIE][ASCII_MAX_CHARACTER + 1]; // Next node by character, 0 is none
+static unsigned char keyword_trie_icode[SIZE_KEYWORD_TRIE];						   // i-code of keyword ending here, or SIZE_KEYWORD_TABLE
+static unsigned char keyword_trie_count;											   // Trie node count
+
+static void build_keyword_trie()
+{
+	unsigned char i, node;
+	const char *keyword_pointer;
+
+	keyword_trie_count = 1; // root
+	keyword_trie_icode[0] = SIZE_KEYWORD_TABLE;
+	for (i = 0; i < SIZE_KEYWORD_TABLE; i++)
+	{
+		node = 0;
+		for (keyword_pointer = keyword_table[i]; *keyword_pointer; keyword_pointer++)
+		{
+			if (!keyword_trie_next[node][(unsigned char)*keyword_pointer])
+			{
+				keyword_trie_icode[keyword_trie_count] = SIZE_KEYWORD_TABLE;
+				keyword_trie_next[node][(unsigned char)*keyword_pointer] = keyword_trie_count;
+				if (*keyword_pointer <= 'Z' && *keyword_pointer >= 'A')
+					keyword_trie_next[node][*keyword_pointer - 'A' + 'a'] = keyword_trie_count;
+				keyword_trie_count++;
+			}
+			node = keyword_trie_next[node][(unsigned char)*keyword_pointer];
+		}
+		if (keyword_trie_icode[node] == SIZE_KEYWORD_TABLE)
+			keyword_trie_icode[node] = i;
+	}
+}
+
+// Match keyword at the pointer
+// Return i-code, or SIZE_KEYWORD_TABLE if no keyword, and set the end pointer
+static unsigned char match_keyword(char *pointer, char **end_pointer)
+{
+	unsigned char node = 0;
+	unsigned char icode = SIZE_KEYWORD_TABLE;
+	unsigned char c;
+
+	while ((c = (unsigned char)*pointer) <= ASCII_MAX_CHARACTER && (node = keyword_trie_next[node][c]))
+	{
+		pointer++;
+		if (keyword_trie_icode[node] < icode)
+		{
+			icode = keyword_trie_icode[node];
+			*end_pointer = pointer;
+		}
+	}
+	return icode;
+}
+
+// List formatting condition
+// no space after
+static const unsigned char i_no_space_after[] = {
+	I_RETURN, I_STOP, I_COMMA,
+	I_MINUS, I_PLUS, I_MUL, I_DIV, I_OPEN, I_CLOSE,
+	I_GTE, I_SHARP, I_GT, I_EQ, I_LTE, I_LT,
+	I_ARRAY, I_RND, I_ABS, I_SIZE};
+
+// no space before (after numeric or variable only)
+static const unsigned char i_no_space_before[] = {
+	I_MINUS, I_PLUS, I_MUL, I_DIV, I_OPEN, I_CLOSE,
+	I_GTE, I_SHARP, I_GT, I_EQ, I_LTE, I_LT,
+	I_COMMA, I_SEMI, I_EOL};
+
+// binary operators (the parser continues after numeric)
+static const unsigned char i_binary_operator[] = {
+	I_MINUS, I_PLUS, I_MUL, I_DIV,
+	I_GTE, I_SHARP, I_GT, I_EQ, I_LTE, I_LT};
+
+// exception search function
+static char sstyle(unsigned char code, const unsigned char *table, unsigned char count)
+{
+	while (count--)
+		if (code == table[count])
+			return 1;
+	return 0;
+}
+
+// exception search macro
+#define nospacea(c) sstyle(c, i_no_space_after, sizeof(i_no_space_after))
+#define nospaceb(c) sstyle(c, i_no_space_before, sizeof(i_no_space_before))
+#define isoperator(c) sstyle(c, i_binary_operator, sizeof(i_binary_operator))
+
+// Error messages
+static const char *errmsg[] = {
+	"OK",
+	"Devision by zero",
+	"Overflow",
+	"Subscript out of range",
+	"Icode buffer full",
+	"List full",
+	"GOSUB too many nested",
+	"RETURN stack underflow",
+	"FOR too many nested",
+	"NEXT without FOR",
+	"NEXT without counter",
+	"NEXT mismatch FOR",
+	"FOR without variable",
+	"FOR without TO",
+	"LET without variable",
+	"IF without condition",
+	"Undefined line number",
+	"\'(\' or \')\' expected",
+	"\'=\' expected",
+	"Illegal command",
+	"Syntax error",
+	"Internal error",
+	"Abort by [ESC]",
+	"File not accessible",
+	"Broken image"};
+
+// Error code assignment
+enum
+{
+	ERR_OK,
+	ERR_DIVBY0,
+	ERR_VOF,
+	ERR_SOR,
+	ERR_IBUFOF,
+	ERR_LBUFOF,
+	ERR_GSTKOF,
+	ERR_GSTKUF,
+	ERR_LSTKOF,
+	ERR_LSTKUF,
+	ERR_NEXTWOV,
+	ERR_NEXTUM,
+	ERR_FORWOV,
+	ERR_FORWOTO,
+	ERR_LETWOV,
+	ERR_IFWOC,
+	ERR_ULN,
+	ERR_PAREN,
+	ERR_VWOEQ,
+	ERR_COM,
+	ERR_SYNTAX,
+	ERR_SYS,
+	ERR_ESC,
+	ERR_FILE,
+	ERR_IMAGE
+};
+
+// Initialize array area
+// With a file, the array is mapped from it, so values set by a program
+// are kept in the file and found there by the next run. The file holds
+// the elements in native byte order and is extended as needed.
+// Return 0 if the size is too large, no memory or the file can't be mapped
+static unsigned char init_array_area(struct tb_context *tb, long size, const char *file_name)
+{
+	int file;
+	struct stat file_status;
+
+	if (!size)
+		size = SIZE_ARRAY_AREA;
+	if (size > SIZE_ARRAY_MAX)
+		return 0;
+	tb->array_area_size = size;
+	if (!file_name)
+	{
+		tb->array_area = calloc(size, sizeof(*tb->array_area));
+		return tb->array_area != NULL;
+	}
+
+	file = open(file_name, O_RDWR | O_CREAT, 0666);
+	if (file < 0 || fstat(file, &file_status) < 0 ||
+		(file_status.st_size < (off_t)(size * sizeof(*tb->array_area)) && ftruncate(file, size * sizeof(*tb->array_area)) < 0))
+	{
+		if (file >= 0)
+			close(file);
+		return 0;
+	}
+	tb->array_area = mmap(NULL, size * sizeof(*tb->array_area), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	close(file); // the mapping stays
+	if (tb->array_area == MAP_FAILED)
+	{
+		tb->array_area = NULL;
+		return 0;
+	}
+	tb->array_area_mapped = 1;
+	return 1;
+}
+
+// Standard C libraly (about) same functions
+static char c_toupper(char c) { return (c <= 'z' && c >= 'a' ? c - ASCII_SPACE : c); }
+static char c_isprint(char c) { return (c >= ASCII_SPACE && c < ASCII_MAX_CHARACTER); }
+static char c_isspace(char c) { return (c == ' ' || (c <= ASCII_CARRIAGE_RETURN && c >= ASCII_TAB)); }
+static char c_isdigit(char c) { return (c <= '9' && c >= '0'); }
+static char c_isalpha(char c) { return ((c <= 'z' && c >= 'a') || (c <= 'Z' && c >= 'A')); }
+static void c_puts(struct tb_context *tb, const char *character_in_line_buffer_pointer)
+{
+	c_write(tb, character_in_line_buffer_pointer, strlen(character_in_line_buffer_pointer));
+}
+// Return 0 at end of input
+static unsigned char c_gets(struct tb_context *tb)
+{
+	int c;
+	unsigned char len;
+
+	c_flush(tb); // Show prompt
+	len = 0;
+	while ((c = c_getch(tb)) != KEY_ENTER)
+	{
+		if (c == EOF)
+		{ // End of input
+			if (len == 0)
+				return 0;
+			break;
+		}
+		if (c == ASCII_TAB)
+			c = ' '; // TAB exchange Space
+		if (((c == ASCII_BACKSPACE) || (c == ASCII_MAX_CHARACTER)) && (len > 0))
+		{ // Backspace manipulation
+			len--;
+			c_putch(tb, ASCII_BACKSPACE);
+			c_putch(tb, ' ');
+			c_putch(tb, ASCII_BACKSPACE);
+		}
+		else if (c_isprint(c) && (len < (SIZE_LINE_COMMAND - 1)))
+		{
+			tb->command_line_buffer[len++] = c;
+			c_putch(tb, c);
+		}
+	}
+	newline(tb);
+	tb->command_line_buffer[len] = 0; // Put NULL
+
+	if (len > 0)
+	{
+		while (c_isspace(tb->command_line_buffer[--len]))
+			;							// Skip space
+		tb->command_line_buffer[++len] = 0; // Put NULL
+	}
+	return 1;
+}
+
+// Copy 1 line of source text to command line buffer
+// Same editing as c_gets without echo
+// Return pointer to the next line
+static const char *c_copy_line(struct tb_context *tb, const char *text, const char *end)
+{
+	char c;
+	unsigned char len;
+
+	len = 0;
+	while (text < end && (c = *text++) != KEY_ENTER)
+	{
+		if (c == ASCII_TAB)
+			c = ' '; // TAB exchange Space
+		if (c_isprint(c) && (len < (SIZE_LINE_COMMAND - 1)))
+			tb->command_line_buffer[len++] = c;
+	}
+	tb->command_line_buffer[len] = 0; // Put NULL
+
+	if (len > 0)
+	{
+		while (c_isspace(tb->command_line_buffer[--len]))
+			;							// Skip space
+		tb->command_line_buffer[++len] = 0; // Put NULL
+	}
+	return text;
+}
+
+// Print numeric specified columns
+static void print_numeric_specified_columns(struct tb_context *tb, short value, short d)
+{
+	char numeric_buffer[7]; // sign, 5 digits and NULL
+	unsigned char i;
+	unsigned char sign;
+
+	if (value < 0)
+	{
+		sign = 1;
+		value = -value;
+	}
+	else
+	{
+		sign = 0;
+	}
+
+	numeric_buffer[6] = 0;
+	i = 6;
+	do
+	{
+		numeric_buffer[--i] = (value % 10) + '0';
+		value /= 10;
+	} while (value > 0);
+
+	if (sign)
+		numeric_buffer[--i] = '-';
+
+	// String length = 6 - i
+	while (6 - i < d)
+	{				  // If short
+		c_putch(tb, ' '); // Fill space
+		d--;
+	}
+	c_puts(tb, &numeric_buffer[i]);
+}
+
+// Input numeric and return value
+// Called by only INPUT statement
+static short input_numeric_and_return_value(struct tb_context *tb)
+{
+	short value, tmp;
+	int c;
+	unsigned char len;
+	unsigned char sign;
+
+	c_flush(tb); // Show prompt
+	len = 0;
+	while ((c = c_getch(tb)) != KEY_ENTER && c != EOF)
+	{
+		if (((c == ASCII_BACKSPACE) || (c == ASCII_MAX_CHARACTER)) && (len > 0))
+		{ // Backspace manipulation
+			len--;
+			if (tb->batch_mode)
+				continue;
+			c_putch(tb, ASCII_BACKSPACE);
+			c_putch(tb, ' ');
+			c_putch(tb, ASCII_BACKSPACE);
+		}
+		else if ((len == 0 && (c == '+' || c == '-')) ||
+				 (len < 6 && c_isdigit(c)))
+		{ // Numeric or sign only
+			tb->command_line_buffer[len++] = c;
+			if (!tb->batch_mode)
+				c_putch(tb, c);
+		}
+	}
+	newline(tb);
+	tb->command_line_buffer[len] = 0;
+
+	switch (tb->command_line_buffer[0])
+	{
+	case '-':
+		sign = 1;
+		len = 1;
+		break;
+	case '+':
+		sign = 0;
+		len = 1;
+		break;
+	default:
+		sign = 0;
+		len = 0;
+		break;
+	}
+
+	value = 0; // Initialize value
+	tmp = 0;   // Temp value
+	while (tb->command_line_buffer[len])
+	{
+		tmp = 10 * value + tb->command_line_buffer[len++] - '0';
+		if (value > tmp)
+		{ // It means overflow
+			tb->err = ERR_VOF;
+		}
+		value = tmp;
+	}
+	if (sign)
+		return -value;
+	return value;
+}
+
+// Convert token to i-code
+// Return byte length or 0
+static unsigned short convert_token_to_icode(struct tb_context *tb)
+{
+	unsigned char i;											  // Loop counter(i-code sometime)
+	unsigned short len = 0;										  // byte counter
+	char *top_of_command_line;									  // Temporary token pointer
+	char *character_in_line_buffer_pointer = tb->command_line_buffer; // Pointer to character in line buffer
+	char c;														  // Surround the string character, " or '
+	short value;												  // numeric
+	short tmp;													  // numeric for overflow check
+
+	while (*character_in_line_buffer_pointer)
+	{
+		while (c_isspace(*character_in_line_buffer_pointer))
+			character_in_line_buffer_pointer++; // Skip space
+
+		// Try keyword conversion
+		i = match_keyword(character_in_line_buffer_pointer, &top_of_command_line);
+		if (i < SIZE_KEYWORD_TABLE)
+		{ // Case success
+
+			if (len >= SIZE_IBUFFER - 1)
+			{ // List area full
+				tb->err = ERR_IBUFOF;
+				return 0;
+			}
+
+			// i have i-code
+			tb->icode_conversion_buffer[len++] = i;
+			character_in_line_buffer_pointer = top_of_command_line;
+		}
+
+		// Case statement needs an argument except numeric, variable, or strings
+		if (i == I_REM)
+		{
+			while (c_isspace(*character_in_line_buffer_pointer))
+				character_in_line_buffer_pointer++; // Skip space
+			top_of_command_line = character_in_line_buffer_pointer;
+			for (i = 0; *top_of_command_line++; i++)
+				; // Get length
+			if (len >= SIZE_IBUFFER - 2 - i)
+			{
+				tb->err = ERR_IBUFOF;
+				return 0;
+			}
+			tb->icode_conversion_buffer[len++] = i; // Put length
+			while (i--)
+			{ // Copy strings
+				tb->icode_conversion_buffer[len++] = *character_in_line_buffer_pointer++;
+			}
+			break;
+		}
+
+		if (i < SIZE_KEYWORD_TABLE)
+			continue;
+
+		top_of_command_line = character_in_line_buffer_pointer; // Point top of command line
+
+		// Try numeric conversion
+		if (c_isdigit(*top_of_command_line))
+		{
+			value = 0;
+			tmp = 0;
+			do
+			{
+				tmp = 10 * value + *top_of_command_line++ - '0';
+				if (value > tmp)
+				{
+					tb->err = ERR_VOF;
+					return 0;
+				}
+				value = tmp;
+			} while (c_isdigit(*top_of_command_line));
+
+			if (len >= SIZE_IBUFFER - 3)
+			{
+				tb->err = ERR_IBUFOF;
+				return 0;
+			}
+			tb->icode_conversion_buffer[len++] = I_NUM;
+			tb->icode_conversion_buffer[len++] = value & MAX_BYTE_VALUE;
+			tb->icode_conversion_buffer[len++] = value >> BITS_IN_BYTE;
+			character_in_line_buffer_pointer = top_of_command_line;
+		}
+		else if (*character_in_line_buffer_pointer == '\"' || *character_in_line_buffer_pointer == '\'') // Try string conversion
+		{
+			// If start of string
+			c = *character_in_line_buffer_pointer++;
+			top_of_command_line = character_in_line_buffer_pointer;
+			for (i = 0; (*top_of_command_line != c) && c_isprint(*top_of_command_line); i++) // Get length
+				top_of_command_line++;
+			if (len >= SIZE_IBUFFER - 1 - i)
+			{ // List area full
+				tb->err = ERR_IBUFOF;
+				return 0;
+			}
+			tb->icode_conversion_buffer[len++] = I_STR; // Put i-code
+			tb->icode_conversion_buffer[len++] = i;		// Put length
+			while (i--)
+			{ // Put string
+				tb->icode_conversion_buffer[len++] = *character_in_line_buffer_pointer++;
+			}
+			if (*character_in_line_buffer_pointer == c)
+				character_in_line_buffer_pointer++; // Skip " or '
+		}
+		else if (c_isalpha(*top_of_command_line)) // Try conversion
+		{
+			if (len >= SIZE_IBUFFER - 2)
+			{
+				tb->err = ERR_IBUFOF;
+				return 0;
+			}
+			if (len >= 4 && tb->icode_conversion_buffer[len - 2] == I_VAR && tb->icode_conversion_buffer[len - 4] == I_VAR)
+			{					  // Case series of variables
+				tb->err = ERR_SYNTAX; // Syntax error
+				return 0;
+			}
+			tb->icode_conversion_buffer[len++] = I_VAR;									// Put i-code
+			tb->icode_conversion_buffer[len++] = c_toupper(*top_of_command_line) - 'A'; // Put index of variable area
+			character_in_line_buffer_pointer++;
+		}
+		else // Nothing much
+		{
+			tb->err = ERR_SYNTAX;
+			return 0;
+		}
+	}
+	tb->icode_conversion_buffer[len++] = I_EOL; // Put end of line
+	return len;								// Return byte length
+}
+
+// Get line length by line pointer
+// 0 means end of list
+static unsigned int get_line_length(unsigned char *line_pointer)
+{
+	return *line_pointer | *(line_pointer + 1) << BITS_IN_BYTE;
+}
+
+// Get line numbere by line pointer
+static short get_line_number_by_line_pointer(unsigned char *line_pointer)
+{
+	if (get_line_length(line_pointer) == 0) // end of list
+		return 32767;						// max line bumber
+	return *(line_pointer + 2) | *(line_pointer + 3) << BITS_IN_BYTE;
+}
+
+// Rebuild line index
+// Called whenever the list area changes
+static void rebuild_line_index(struct tb_context *tb)
+{
+	unsigned char *line_pointer;
+
+	tb->line_index_count = 0;
+	for (line_pointer = tb->list_area; get_line_length(line_pointer); line_pointer += get_line_length(line_pointer))
+	{
+		tb->line_index_number[tb->line_index_count] = get_line_number_by_line_pointer(line_pointer);
+		tb->line_index_offset[tb->line_index_count++] = line_pointer - tb->list_area;
+	}
+	tb->line_index_number[tb->line_index_count] = 32767;				 // end of list
+	tb->line_index_offset[tb->line_index_count] = line_pointer - tb->list_area; // point end of list
+	tb->list_length = line_pointer - tb->list_area;
+	if (tb->list_length > tb->list_length_high)
+		tb->list_length_high = tb->list_length;
+}
+
+// Search line index by line number
+// Return index of the first line whose number is line_number or greater
+static unsigned int search_line_index(struct tb_context *tb, short line_number)
+{
+	unsigned int low, high, middle;
+
+	// binary search in line index
+	low = 0;
+	high = tb->line_index_count;
+	tb->line_search_count++;
+	while (low < high)
+	{
+		tb->line_probe_count++;
+		middle = (low + high) / 2;
+		if (tb->line_index_number[middle] < line_number)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+// Search line by line number
+// Return the first line whose number is line_number or greater, or end of list
+static unsigned char *search_line_by_line_number(struct tb_context *tb, short line_number)
+{
+	return tb->list_area + tb->line_index_offset[search_line_index(tb, line_number)];
+}
+
+// Get pointer to next i-code
+static unsigned char *get_next_icode(unsigned char *ip)
+{
+	switch (*ip)
+	{
+	case I_NUM:
+		return ip + 3;
+	case I_VAR:
+		return ip + 2;
+	case I_STR:
+	case I_REM:
+		return ip + 2 + *(ip + 1);
+	default:
+		return ip + 1;
+	}
+}
+
+// Get site table entry of offset
+// Return the entry, or the free entry to store it in
+static struct site_entry *get_site_entry(struct site_table *table, unsigned int offset)
+{
+	unsigned int i;
+
+	for (i = (offset + 1) * 2654435761u & (table->size - 1); table->entry[i].key && table->entry[i].key != offset + 1; i = (i + 1) & (table->size - 1))
+		;
+	return &table->entry[i];
+}
+
+// Find value of offset in site table
+// Return 0 if not there
+static unsigned int find_site(struct site_table *table, unsigned int offset)
+{
+	if (!table->count)
+		return 0;
+	return get_site_entry(table, offset)->value;
+}
+
+// Store value of offset in site table
+// The table is doubled when 3/4 full
+// Return 0 if no memory
+static unsigned char store_site(struct site_table *table, unsigned int offset, unsigned int value)
+{
+	struct site_table new_table;
+	struct site_entry *entry;
+	unsigned int i;
+
+	if ((table->count + 1) * 4 > table->size * 3)
+	{
+		new_table.size = table->size ? table->size * 2 : SIZE_SITE_TABLE;
+		new_table.count = table->count;
+		new_table.entry = calloc(new_table.size, sizeof(*new_table.entry));
+		if (!new_table.entry)
+			return 0;
+		for (i = 0; i < table->size; i++)
+			if (table->entry[i].key)
+				*get_site_entry(&new_table, table->entry[i].key - 1) = table->entry[i];
+		free(table->entry);
+		*table = new_table;
+	}
+
+	entry = get_site_entry(table, offset);
+	if (!entry->key)
+		table->count++;
+	entry->key = offset + 1;
+	entry->value = value;
+	return 1;
+}
+
+// Clear site table, keeping its entries allocated
+static void clear_site_table(struct site_table *table)
+{
+	if (!table->count)
+		return;
+	memset(table->entry, 0, table->size * sizeof(*table->entry));
+	table->count = 0;
+}
+
+// Drop branch links
+// Called whenever the list area changes
+static void drop_branch_links(struct tb_context *tb)
+{
+	clear_site_table(&tb->branch_links);
+	tb->branch_links_resolved = 0;
+}
+
+// Resolve branch links
+// Link GOTO and GOSUB with constant line number to the target line
+// Undefined line numbers are left to the dynamic path to report the error,
+// as are sites that can't be stored for want of memory
+static void resolve_branch_links(struct tb_context *tb)
+{
+	unsigned char *line_pointer;
+	unsigned char *ip;
+	unsigned char *target;
+	short line_number;
+
+	if (tb->branch_links_resolved)
+		return;
+
+	for (line_pointer = tb->list_area; get_line_length(line_pointer); line_pointer += get_line_length(line_pointer))
+		for (ip = line_pointer + SIZE_LINE_HEADER; *ip != I_EOL; ip = get_next_icode(ip))
+		{
+			if ((*ip != I_GOTO && *ip != I_GOSUB) || *(ip + 1) != I_NUM || isoperator(*(ip + 4)))
+				continue;
+			line_number = *(ip + 2) | *(ip + 3) << BITS_IN_BYTE;
+			target = search_line_by_line_number(tb, line_number);
+			if (line_number == get_line_number_by_line_pointer(target))
+				store_site(&tb->branch_links, ip - tb->list_area, target - tb->list_area + 1);
+		}
+	tb->branch_links_resolved = 1;
+}
+
+// Reserve list area
+// The list area and line index grow together
+// The line index holds a line per SIZE_LINE_MIN bytes, and no more than
+// there are line numbers, plus the end of list
+// The current line and i-code move with the list area. The stacks are
+// emptied by every change of the list, so they don't point into it.
+// Return 0 if the list can't be that large
+static unsigned char reserve_list_area(struct tb_context *tb, unsigned int size)
+{
+	unsigned int new_size;
+	unsigned int index_size;
+	unsigned char *new_list_area;
+	void *new_area;
+	unsigned char line_in_list, icode_in_list;
+	unsigned int line_offset, icode_offset;
+
+	if (size <= tb->list_area_size)
+		return 1;
+	if (size > SIZE_LIST_MAX)
+		return 0;
+
+	for (new_size = SIZE_LIST_BUFFER; new_size < size; new_size *= 2)
+		;
+	if (new_size > SIZE_LIST_MAX)
+		new_size = SIZE_LIST_MAX;
+
+	line_in_list = tb->list_area && tb->current_line >= tb->list_area && tb->current_line < tb->list_area + tb->list_area_size;
+	icode_in_list = tb->list_area && tb->current_icode >= tb->list_area && tb->current_icode < tb->list_area + tb->list_area_size;
+	line_offset = line_in_list ? tb->current_line - tb->list_area : 0;
+	icode_offset = icode_in_list ? tb->current_icode - tb->list_area : 0;
+
+	new_list_area = realloc(tb->list_area, new_size);
+	if (!new_list_area)
+		return 0;
+	if (!tb->list_area)
+		*new_list_area = *(new_list_area + 1) = 0; // empty list
+	tb->list_area = new_list_area;
+	if (line_in_list)
+		tb->current_line = tb->list_area + line_offset;
+	if (icode_in_list)
+		tb->current_icode = tb->list_area + icode_offset;
+
+	index_size = new_size / SIZE_LINE_MIN < SIZE_LINE_NUMBERS ? new_size / SIZE_LINE_MIN : SIZE_LINE_NUMBERS;
+	new_area = realloc(tb->line_index_number, (index_size + 1) * sizeof(*tb->line_index_number));
+	if (!new_area)
+		return 0;
+	tb->line_index_number = new_area;
+	new_area = realloc(tb->line_index_offset, (index_size + 1) * sizeof(*tb->line_index_offset));
+	if (!new_area)
+		return 0;
+	tb->line_index_offset = new_area;
+
+	tb->list_area_size = new_size;
+	rebuild_line_index(tb);
+	return 1;
+}
+
+// Return free memory size
+static short return_free_memory_size(struct tb_context *tb)
+{
+	unsigned int size;
+
+	size = SIZE_LIST_MAX - tb->list_length - 2;
+	if (size > 32767)
+		return 32767; // max of numeric
+	return size;
+}
+
+// Peephole optimizer
+// When a line is stored, constant subexpressions are folded and numerics
+// with unary minus are pre-negated. If that changes the line, the original
+// i-code is kept after the I_EOL of the optimized one for LIST.
+
+static unsigned char o_expression(struct tb_context *tb, short *value, unsigned char *constant); // prototype
+
+// Copy i-code as it is
+static void o_copy(struct tb_context *tb, unsigned short len)
+{
+	while (len--)
+		tb->icode_optimize_buffer[tb->optimize_length++] = *tb->optimize_icode++;
+}
+
+// Replace i-code from top by numeric
+static void o_fold(struct tb_context *tb, unsigned short top, short value)
+{
+	tb->optimize_length = top;
+	tb->icode_optimize_buffer[tb->optimize_length++] = I_NUM;
+	tb->icode_optimize_buffer[tb->optimize_length++] = value & MAX_BYTE_VALUE;
+	tb->icode_optimize_buffer[tb->optimize_length++] = value >> BITS_IN_BYTE;
+}
+
+// Optimize argument in parenthesis
+static unsigned char o_argument(struct tb_context *tb, short *value, unsigned char *constant)
+{
+	if (*tb->optimize_icode != I_OPEN)
+		return 0;
+	o_copy(tb, 1);
+	if (!o_expression(tb, value, constant))
+		return 0;
+	if (*tb->optimize_icode != I_CLOSE)
+		return 0;
+	o_copy(tb, 1);
+	return 1;
+}
+
+// Optimize value
+static unsigned char o_value(struct tb_context *tb, short *value, unsigned char *constant)
+{
+	unsigned short top;
+
+	top = tb->optimize_length;
+	*constant = 0;
+	switch (*tb->optimize_icode)
+	{
+	case I_NUM:
+		*value = *(tb->optimize_icode + 1) | *(tb->optimize_icode + 2) << BITS_IN_BYTE;
+		*constant = 1;
+		o_copy(tb, 3);
+		return 1;
+	case I_PLUS:
+		o_copy(tb, 1);
+		if (!o_value(tb, value, constant))
+			return 0;
+		break;
+	case I_MINUS:
+		o_copy(tb, 1);
+		if (!o_value(tb, value, constant))
+			return 0;
+		if (*constant)
+			*value = 0 - *value;
+		break;
+	case I_VAR:
+		o_copy(tb, 2);
+		return 1;
+	case I_OPEN:
+		if (!o_argument(tb, value, constant))
+			return 0;
+		break;
+	case I_ABS:
+		o_copy(tb, 1);
+		if (!o_argument(tb, value, constant))
+			return 0;
+		if (*constant && *value < 0)
+			*value *= -1;
+		break;
+	case I_ARRAY:
+	case I_RND:
+		o_copy(tb, 1);
+		if (!o_argument(tb, value, constant))
+			return 0;
+		*constant = 0;
+		return 1;
+	case I_SIZE:
+		o_copy(tb, 1);
+		if ((*tb->optimize_icode != I_OPEN) || (*(tb->optimize_icode + 1) != I_CLOSE))
+			return 0;
+		o_copy(tb, 2);
+		return 1;
+	default:
+		return 0;
+	}
+
+	if (*constant)
+		o_fold(tb, top, *value);
+	return 1;
+}
+
+// Optimize multiply or divide calculation
+static unsigned char o_term(struct tb_context *tb, short *value, unsigned char *constant)
+{
+	unsigned short top;
+	unsigned char code;
+	short tmp;
+	unsigned char tmp_constant;
+
+	top = tb->optimize_length;
+	if (!o_value(tb, value, constant))
+		return 0;
+
+	while (*tb->optimize_icode == I_MUL || *tb->optimize_icode == I_DIV)
+	{
+		code = *tb->optimize_icode;
+		o_copy(tb, 1);
+		if (!o_value(tb, &tmp, &tmp_constant))
+			return 0;
+		if (!*constant || !tmp_constant || (code == I_DIV && tmp == 0))
+		{ // leave division by zero to run time
+			*constant = 0;
+			continue;
+		}
+		if (code == I_MUL)
+			*value *= tmp;
+		else
+			*value /= tmp;
+		o_fold(tb, top, *value);
+	}
+	return 1;
+}
+
+// Optimize add or subtract calculation
+static unsigned char o_sum(struct tb_context *tb, short *value, unsigned char *constant)
+{
+	unsigned short top;
+	unsigned char code;
+	short tmp;
+	unsigned char tmp_constant;
+
+	top = tb->optimize_length;
+	if (!o_term(tb, value, constant))
+		return 0;
+
+	while (*tb->optimize_icode == I_PLUS || *tb->optimize_icode == I_MINUS)
+	{
+		code = *tb->optimize_icode;
+		o_copy(tb, 1);
+		if (!o_term(tb, &tmp, &tmp_constant))
+			return 0;
+		if (!*constant || !tmp_constant)
+		{
+			*constant = 0;
+			continue;
+		}
+		if (code == I_PLUS)
+			*value += tmp;
+		else
+			*value -= tmp;
+		o_fold(tb, top, *value);
+	}
+	return 1;
+}
+
+// Optimize conditional expression
+static unsigned char o_expression(struct tb_context *tb, short *value, unsigned char *constant)
+{
+	unsigned short top;
+	unsigned char code;
+	short tmp;
+	unsigned char tmp_constant;
+
+	top = tb->optimize_length;
+	if (!o_sum(tb, value, constant))
+		return 0;
+
+	while (1)
+	{
+		code = *tb->optimize_icode;
+		if (code != I_EQ && code != I_SHARP && code != I_LT &&
+			code != I_LTE && code != I_GT && code != I_GTE)
+			return 1;
+		o_copy(tb, 1);
+		if (!o_sum(tb, &tmp, &tmp_constant))
+			return 0;
+		if (!*constant || !tmp_constant)
+		{
+			*constant = 0;
+			continue;
+		}
+		switch (code)
+		{
+		case I_EQ:
+			*value = (*value == tmp);
+			break;
+		case I_SHARP:
+			*value = (*value != tmp);
+			break;
+		case I_LT:
+			*value = (*value < tmp);
+			break;
+		case I_LTE:
+			*value = (*value <= tmp);
+			break;
+		case I_GT:
+			*value = (*value > tmp);
+			break;
+		default: // I_GTE
+			*value = (*value >= tmp);
+			break;
+		}
+		o_fold(tb, top, *value);
+	}
+}
+
+// Optimize the line in i-code conversion buffer
+// Expressions are found wherever a value can start. Statements where the
+// interpreter does not read an expression never have a constant to fold,
+// so they are copied unchanged.
+// Return new byte length
+static unsigned short optimize_icode_in_the_buffer(struct tb_context *tb, unsigned short len)
+{
+	short value;
+	unsigned char constant;
+
+	tb->optimize_icode = tb->icode_conversion_buffer;
+	tb->optimize_length = 0;
+	o_copy(tb, 3); // I_NUM and line number
+
+	while (*tb->optimize_icode != I_EOL)
+		switch (*tb->optimize_icode)
+		{
+		case I_NUM:
+		case I_VAR:
+		case I_PLUS:
+		case I_MINUS:
+		case I_OPEN:
+		case I_ARRAY:
+		case I_RND:
+		case I_ABS:
+		case I_SIZE:
+			if (!o_expression(tb, &value, &constant))
+				return len; // leave it to run time
+			break;
+		case I_REM:
+			o_copy(tb, 2 + *(tb->optimize_icode + 1));
+			break;
+		case I_STR:
+			o_copy(tb, 2 + *(tb->optimize_icode + 1));
+			break;
+		default:
+			o_copy(tb, 1);
+			break;
+		}
+	o_copy(tb, 1); // I_EOL
+
+	if (tb->optimize_length == len && memcmp(tb->icode_optimize_buffer, tb->icode_conversion_buffer, len) == 0)
+		return len; // nothing changed
+
+	// Put original i-code after optimized one
+	memcpy(tb->icode_optimize_buffer + tb->optimize_length, tb->icode_conversion_buffer + 3, len - 3);
+	memcpy(tb->icode_conversion_buffer, tb->icode_optimize_buffer, tb->optimize_length + len - 3);
+	return tb->optimize_length + len - 3;
+}
+
+// Get i-code to list
+// Return original i-code if the line is optimized
+static unsigned char *get_source_icode(unsigned char *line_pointer)
+{
+	unsigned char *ip;
+
+	for (ip = line_pointer + SIZE_LINE_HEADER; *ip != I_EOL; ip = get_next_icode(ip))
+		;
+	ip++; // skip I_EOL
+	if (ip < line_pointer + get_line_length(line_pointer))
+		return ip;
+	return line_pointer + SIZE_LINE_HEADER;
+}
+
+// Insert i-code to the list
+// Preconditions to do icode_conversion_buffer holds I_NUM, line number
+// and i-code of len bytes
+// The end of list and the line index are updated as lines move
+static void insert_icode_to_the_list_preconditions(struct tb_context *tb, unsigned short len)
+{
+	unsigned char *insp;
+	unsigned int size;
+	unsigned int line_length;
+	unsigned int position, i;
+	short line_number;
+
+	if (len > 4)
+		len = optimize_icode_in_the_buffer(tb, len);
+	line_number = *(tb->icode_conversion_buffer + 1) | *(tb->icode_conversion_buffer + 2) << BITS_IN_BYTE;
+	line_length = len + 1; // I_NUM is replaced by 2 bytes length
+
+	if (!reserve_list_area(tb, tb->list_length + line_length + 2))
+	{
+		tb->err = ERR_LBUFOF; // List buffer overflow
+		return;
+	}
+
+	drop_branch_links(tb);
+	drop_expression_cache(tb);
+	tb->gosub_stack_index = 0; // pointers in the stacks may move
+	tb->for_stack_index = 0;
+
+	position = search_line_index(tb, line_number);
+	insp = tb->list_area + tb->line_index_offset[position];
+
+	if (tb->line_index_number[position] == line_number)
+	{ // line number agree
+		size = get_line_length(insp);
+		memmove(insp, insp + size, tb->list_area + tb->list_length + 2 - (insp + size)); // following lines and end of list
+		tb->list_length -= size;
+
+		// Remove from line index
+		memmove(tb->line_index_number + position, tb->line_index_number + position + 1, (tb->line_index_count - position) * sizeof(*tb->line_index_number));
+		memmove(tb->line_index_offset + position, tb->line_index_offset + position + 1, (tb->line_index_count - position) * sizeof(*tb->line_index_offset));
+		tb->line_index_count--;
+		for (i = position; i <= tb->line_index_count; i++)
+			tb->line_index_offset[i] -= size;
+	}
+
+	// Case line number only
+	if (len == 4)
+		return;
+
+	// Make space
+	memmove(insp + line_length, insp, tb->list_area + tb->list_length + 2 - insp); // following lines and end of list
+	tb->list_length += line_length;
+	if (tb->list_length > tb->list_length_high)
+		tb->list_length_high = tb->list_length;
+
+	// Insert
+	*insp = line_length & MAX_BYTE_VALUE;
+	*(insp + 1) = line_length >> BITS_IN_BYTE;
+	memcpy(insp + 2, tb->icode_conversion_buffer + 1, len - 1);
+
+	// Add to line index
+	memmove(tb->line_index_number + position + 1, tb->line_index_number + position, (tb->line_index_count + 1 - position) * sizeof(*tb->line_index_number));
+	memmove(tb->line_index_offset + position + 1, tb->line_index_offset + position, (tb->line_index_count + 1 - position) * sizeof(*tb->line_index_offset));
+	tb->line_index_count++;
+	tb->line_index_number[position] = line_number;
+	tb->line_index_offset[position] = insp - tb->list_area;
+	for (i = position + 1; i <= tb->line_index_count; i++)
+		tb->line_index_offset[i] += line_length;
+}
+
+// Batch load
+// Lines read from a file are collected as line records in the load area
+// and merged into the list in one pass, instead of one insert per line.
+// A record with no i-code deletes the line.
+
+// Compare load records by line number, then by the order read
+static int compare_load_records(const void *a, const void *b)
+{
+	const struct load_record *record_a = a;
+	const struct load_record *record_b = b;
+
+	if (record_a->number != record_b->number)
+		return record_a->number < record_b->number ? -1 : 1;
+	return record_a->offset < record_b->offset ? -1 : record_a->offset > record_b->offset;
+}
+
+// Add i-code to the load area
+// Preconditions are the same as insert_icode_to_the_list_preconditions
+static void load_icode_to_the_batch_preconditions(struct tb_context *tb, unsigned short len)
+{
+	unsigned char *record;
+	unsigned int line_length;
+	void *new_area;
+
+	if (len > 4)
+		len = optimize_icode_in_the_buffer(tb, len);
+	line_length = len == 4 ? SIZE_LINE_HEADER : len + 1u; // line number only deletes the line
+
+	if (tb->load_length + line_length > tb->load_area_size)
+	{
+		new_area = realloc(tb->load_area, tb->load_area_size ? tb->load_area_size * 2 + line_length : SIZE_LIST_BUFFER);
+		if (!new_area)
+		{
+			tb->err = ERR_LBUFOF; // List buffer overflow
+			return;
+		}
+		tb->load_area = new_area;
+		tb->load_area_size = tb->load_area_size ? tb->load_area_size * 2 + line_length : SIZE_LIST_BUFFER;
+	}
+	if (tb->load_count == tb->load_index_size)
+	{
+		new_area = realloc(tb->load_index, (tb->load_index_size ? tb->load_index_size * 2 : SIZE_LIST_BUFFER) * sizeof(*tb->load_index));
+		if (!new_area)
+		{
+			tb->err = ERR_LBUFOF; // List buffer overflow
+			return;
+		}
+		tb->load_index = new_area;
+		tb->load_index_size = tb->load_index_size ? tb->load_index_size * 2 : SIZE_LIST_BUFFER;
+	}
+
+	record = tb->load_area + tb->load_length;
+	*record = line_length & MAX_BYTE_VALUE;
+	*(record + 1) = line_length >> BITS_IN_BYTE;
+	memcpy(record + 2, tb->icode_conversion_buffer + 1, line_length - 2);
+
+	if (!tb->load_count)
+		tb->load_sorted = 1;
+	else if (tb->load_index[tb->load_count - 1].number >= get_line_number_by_line_pointer(record))
+		tb->load_sorted = 0;
+	tb->load_index[tb->load_count].number = get_line_number_by_line_pointer(record);
+	tb->load_index[tb->load_count++].offset = tb->load_length;
+	tb->load_length += line_length;
+}
+
+// Merge the load area into the list
+// Later records replace earlier ones and lines already in the list
+static void load_batch_to_the_list(struct tb_context *tb)
+{
+	unsigned char *merge_area;
+	unsigned char *line_pointer, *record;
+	unsigned int merge_length;
+	unsigned int i, size;
+	short line_number;
+
+	if (!tb->load_count)
+		return;
+	if (!tb->load_sorted)
+		qsort(tb->load_index, tb->load_count, sizeof(*tb->load_index), compare_load_records);
+
+	merge_area = malloc(tb->list_length + tb->load_length + 2);
+	if (!merge_area)
+	{
+		tb->err = ERR_LBUFOF; // List buffer overflow
+		tb->load_count = tb->load_length = 0;
+		return;
+	}
+
+	merge_length = 0;
+	line_pointer = tb->list_area;
+	for (i = 0; i < tb->load_count; i++)
+	{
+		record = tb->load_area + tb->load_index[i].offset;
+		line_number = tb->load_index[i].number;
+		if (i + 1 < tb->load_count && tb->load_index[i + 1].number == line_number)
+			continue; // replaced by later record
+
+		// Lines in the list before this one
+		while (get_line_number_by_line_pointer(line_pointer) < line_number)
+		{
+			size = get_line_length(line_pointer);
+			memcpy(merge_area + merge_length, line_pointer, size);
+			merge_length += size;
+			line_pointer += size;
+		}
+		if (get_line_length(line_pointer) && get_line_number_by_line_pointer(line_pointer) == line_number)
+			line_pointer += get_line_length(line_pointer); // replaced
+
+		size = get_line_length(record);
+		if (size == SIZE_LINE_HEADER)
+			continue; // deleted
+		memcpy(merge_area + merge_length, record, size);
+		merge_length += size;
+	}
+	size = tb->list_area + tb->list_length - line_pointer; // rest of the list
+	memcpy(merge_area + merge_length, line_pointer, size);
+	merge_length += size;
+	*(merge_area + merge_length) = *(merge_area + merge_length + 1) = 0; // end of list
+
+	tb->load_count = tb->load_length = 0;
+
+	if (!reserve_list_area(tb, merge_length + 2))
+	{
+		tb->err = ERR_LBUFOF; // List buffer overflow
+		free(merge_area);
+		return;
+	}
+	drop_branch_links(tb);
+	drop_expression_cache(tb);
+	tb->gosub_stack_index = 0; // pointers in the stacks may move
+	tb->for_stack_index = 0;
+
+	memcpy(tb->list_area, merge_area, merge_length + 2);
+	free(merge_area);
+	rebuild_line_index(tb);
+}
+
+// Listing 1 line of i-code
+static void listing_1_line_of_icode(struct tb_context *tb, unsigned char *ip)
+{
+	unsigned char i;
+
+	while (*ip != I_EOL)
+	{
+		// Case keyword
+		if (*ip < SIZE_KEYWORD_TABLE)
+		{
+			c_puts(tb, keyword_table[*ip]);
+			if (!nospacea(*ip))
+				c_putch(tb, ' ');
+			if (*ip == I_REM)
+			{
+				ip++;
+				i = *ip++;
+				c_write(tb, (char *)ip, i);
+				return;
+			}
+			ip++;
+		}
+		else if (*ip == I_NUM) // Case numeric
+		{
+			ip++;
+			print_numeric_specified_columns(tb, *ip | *(ip + 1) << BITS_IN_BYTE, 0);
+			ip += 2;
+			if (!nospaceb(*ip))
+				c_putch(tb, ' ');
+		}
+		else if (*ip == I_VAR) // Case variable
+		{
+			ip++;
+			c_putch(tb, *ip++ + 'A');
+			if (!nospaceb(*ip))
+				c_putch(tb, ' ');
+		}
+		else if (*ip == I_STR) // Case string
+		{
+			char c;
+
+			c = '\"';
+			ip++;
+			for (i = *ip; i; i--)
+				if (*(ip + i) == '\"')
+				{
+					c = '\'';
+					break;
+				}
+
+			c_putch(tb, c);
+			i = *ip++;
+			c_write(tb, (char *)ip, i);
+			ip += i;
+			c_putch(tb, c);
+			if (*ip == I_VAR)
+				c_putch(tb, ' ');
+		}
+
+		else // Nothing match, I think, such case is impossible
+		{
+			tb->err = ERR_SYS;
+			return;
+		}
+	}
+}
+
+// Get argument in parenthesis
+static short get_argument_in_parenthesis(struct tb_context *tb)
+{
+	short value;
+
+	if (*tb->current_icode != I_OPEN)
+	{
+		tb->err = ERR_PAREN;
+		return 0;
+	}
+	tb->current_icode++;
+	value = i_the_parser(tb);
+	if (tb->err)
+		return 0;
+
+	if (*tb->current_icode != I_CLOSE)
+	{
+		tb->err = ERR_PAREN;
+		return 0;
+	}
+	tb->current_icode++;
+
+	return value;
+}
+
+// Get value
+static short i_get_value(struct tb_context *tb)
+{
+	short value;
+
+	switch (*tb->current_icode)
+	{
+	case I_NUM:
+		tb->current_icode++;
+		value = *tb->current_icode | *(tb->current_icode + 1) << BITS_IN_BYTE;
+		tb->current_icode += 2;
+		break;
+	case I_PLUS:
+		tb->current_icode++;
+		value = i_get_value(tb);
+		break;
+	case I_MINUS:
+		tb->current_icode++;
+		value = 0 - i_get_value(tb);
+		break;
+	case I_VAR:
+		tb->current_icode++;
+		value = tb->variable_area[*tb->current_icode++];
+		break;
+	case I_OPEN:
+		value = get_argument_in_parenthesis(tb);
+		break;
+	case I_ARRAY:
+		tb->current_icode++;
+		value = get_argument_in_parenthesis(tb);
+		if (tb->err)
+			break;
+		if (value < 0 || value >= tb->array_area_size)
+		{
+			tb->err = ERR_SOR;
+			break;
+		}
+		value = tb->array_area[value];
+		break;
+	case I_RND:
+		tb->current_icode++;
+		value = get_argument_in_parenthesis(tb);
+		if (tb->err)
+			break;
+		value = get_random_number(tb, value);
+		break;
+	case I_ABS:
+		tb->current_icode++;
+		value = get_argument_in_parenthesis(tb);
+		if (tb->err)
+			break;
+		if (value < 0)
+			value *= -1;
+		break;
+	case I_SIZE:
+		tb->current_icode++;
+		if ((*tb->current_icode != I_OPEN) || (*(tb->current_icode + 1) != I_CLOSE))
+		{
+			tb->err = ERR_PAREN;
+			break;
+		}
+		tb->current_icode += 2;
+		value = return_free_memory_size(tb);
+		break;
+
+	default:
+		tb->err = ERR_SYNTAX;
+		break;
+	}
+	return value;
+}
+
+// multiply or divide calculation
+static short i_multiply_or_divide_calculation(struct tb_context *tb)
+{
+	short value, tmp;
+
+	value = i_get_value(tb);
+	if (tb->err)
+		return -1;
+
+	while (1)
+		switch (*tb->current_icode)
+		{
+		case I_MUL:
+			tb->current_icode++;
+			tmp = i_get_value(tb);
+			value *= tmp;
+			break;
+		case I_DIV:
+			tb->current_icode++;
+			tmp = i_get_value(tb);
+			if (tmp == 0)
+			{
+				tb->err = ERR_DIVBY0;
+				return -1;
+			}
+			value /= tmp;
+			break;
+		default:
+			return value;
+		}
+}
+
+// add or subtract calculation
+static short i_add_or_subtract_calculation(struct tb_context *tb)
+{
+	short value, tmp;
+
+	value = i_multiply_or_divide_calculation(tb);
+	if (tb->err)
+		return -1;
+
+	while (1)
+		switch (*tb->current_icode)
+		{
+		case I_PLUS:
+			tb->current_icode++;
+			tmp = i_multiply_or_divide_calculation(tb);
+			value += tmp;
+			break;
+		case I_MINUS:
+			tb->current_icode++;
+			tmp = i_multiply_or_divide_calculation(tb);
+			value -= tmp;
+			break;
+		default:
+			return value;
+		}
+}
+
+// Bytecode engine
+// Each expression in the list is compiled to postfix code the first time it
+// is evaluated. The code is cached by i-code offset until the list changes.
+
+// Bytecode assignment
+enum
+{
+	B_NUM,   // push numeric
+	B_VAR,   // push variable
+	B_ARRAY, // replace index by array element
+	B_RND,
+	B_ABS,
+	B_SIZE, // push free memory size
+	B_NEG,
+	B_ADD,
+	B_SUB,
+	B_MUL,
+	B_DIV,
+	B_EQ,
+	B_SHARP,
+	B_LT,
+	B_LTE,
+	B_GT,
+	B_GTE,
+	B_END // return top of stack
+};
+
+// Expression cache entry
+#define EXPRESSION_NOT_COMPILED 0
+#define EXPRESSION_NOT_COMPILABLE 1 // other values are bytecode index + 2
+
+// Drop expression cache
+// Called whenever the list area changes
+static void drop_expression_cache(struct tb_context *tb)
+{
+	clear_site_table(&tb->expression_cache);
+	tb->bytecode_length = 0;
+}
+
+// Put bytecode
+static unsigned char b_emit(struct tb_context *tb, int code)
+{
+	int *new_area;
+
+	if (tb->bytecode_length >= tb->bytecode_area_size)
+	{ // grow bytecode area
+		new_area = realloc(tb->bytecode_area, (tb->bytecode_area_size ? tb->bytecode_area_size * 2 : SIZE_BYTECODE_AREA) * sizeof(*tb->bytecode_area));
+		if (!new_area)
+			return 0;
+		tb->bytecode_area = new_area;
+		tb->bytecode_area_size = tb->bytecode_area_size ? tb->bytecode_area_size * 2 : SIZE_BYTECODE_AREA;
+	}
+	tb->bytecode_area[tb->bytecode_length++] = code;
+	return 1;
+}
+
+// Count up stack depth
+static unsigned char b_push(struct tb_context *tb)
+{
+	return ++tb->compile_depth <= SIZE_BYTECODE_STACK;
+}
+
+static unsigned char b_compile_expression(struct tb_context *tb); // prototype
+
+// Compile argument in parenthesis
+static unsigned char b_compile_argument(struct tb_context *tb)
+{
+	if (*tb->compile_icode != I_OPEN)
+		return 0;
+	tb->compile_icode++;
+	if (!b_compile_expression(tb))
+		return 0;
+	if (*tb->compile_icode != I_CLOSE)
+		return 0;
+	tb->compile_icode++;
+	return 1;
+}
+
+// Compile value
+static unsigned char b_compile_value(struct tb_context *tb)
+{
+	short value;
+
+	switch (*tb->compile_icode)
+	{
+	case I_NUM:
+		value = *(tb->compile_icode + 1) | *(tb->compile_icode + 2) << BITS_IN_BYTE;
+		tb->compile_icode += 3;
+		return b_push(tb) && b_emit(tb, B_NUM) && b_emit(tb, value);
+	case I_PLUS:
+		tb->compile_icode++;
+		return b_compile_value(tb);
+	case I_MINUS:
+		tb->compile_icode++;
+		return b_compile_value(tb) && b_emit(tb, B_NEG);
+	case I_VAR:
+		tb->compile_icode += 2;
+		return b_push(tb) && b_emit(tb, B_VAR) && b_emit(tb, *(tb->compile_icode - 1));
+	case I_OPEN:
+		return b_compile_argument(tb);
+	case I_ARRAY:
+		tb->compile_icode++;
+		return b_compile_argument(tb) && b_emit(tb, B_ARRAY);
+	case I_RND:
+		tb->compile_icode++;
+		return b_compile_argument(tb) && b_emit(tb, B_RND);
+	case I_ABS:
+		tb->compile_icode++;
+		return b_compile_argument(tb) && b_emit(tb, B_ABS);
+	case I_SIZE:
+		tb->compile_icode++;
+		if ((*tb->compile_icode != I_OPEN) || (*(tb->compile_icode + 1) != I_CLOSE))
+			return 0;
+		tb->compile_icode += 2;
+		return b_push(tb) && b_emit(tb, B_SIZE);
+	default:
+		return 0;
+	}
+}
+
+// Compile multiply or divide calculation
+static unsigned char b_compile_term(struct tb_context *tb)
+{
+	short code;
+
+	if (!b_compile_value(tb))
+		return 0;
+	while (1)
+	{
+		switch (*tb->compile_icode)
+		{
+		case I_MUL:
+			code = B_MUL;
+			break;
+		case I_DIV:
+			code = B_DIV;
+			break;
+		default:
+			return 1;
+		}
+		tb->compile_icode++;
+		if (!b_compile_value(tb) || !b_emit(tb, code))
+			return 0;
+		tb->compile_depth--;
+	}
+}
+
+// Compile add or subtract calculation
+static unsigned char b_compile_sum(struct tb_context *tb)
+{
+	short code;
+
+	if (!b_compile_term(tb))
+		return 0;
+	while (1)
+	{
+		switch (*tb->compile_icode)
+		{
+		case I_PLUS:
+			code = B_ADD;
+			break;
+		case I_MINUS:
+			code = B_SUB;
+			break;
+		default:
+			return 1;
+		}
+		tb->compile_icode++;
+		if (!b_compile_term(tb) || !b_emit(tb, code))
+			return 0;
+		tb->compile_depth--;
+	}
+}
+
+// Compile conditional expression
+static unsigned char b_compile_expression(struct tb_context *tb)
+{
+	short code;
+
+	if (!b_compile_sum(tb))
+		return 0;
+	while (1)
+	{
+		switch (*tb->compile_icode)
+		{
+		case I_EQ:
+			code = B_EQ;
+			break;
+		case I_SHARP:
+			code = B_SHARP;
+			break;
+		case I_LT:
+			code = B_LT;
+			break;
+		case I_LTE:
+			code = B_LTE;
+			break;
+		case I_GT:
+			code = B_GT;
+			break;
+		case I_GTE:
+			code = B_GTE;
+			break;
+		default:
+			return 1;
+		}
+		tb->compile_icode++;
+		if (!b_compile_sum(tb) || !b_emit(tb, code))
+			return 0;
+		tb->compile_depth--;
+	}
+}
+
+// Get compiled expression at current_icode
+// Return bytecode, or NULL to use the i-code parser
+// bytecode[0] is the i-code offset to continue from
+static int *get_compiled_expression(struct tb_context *tb)
+{
+	unsigned int offset;
+	unsigned int entry;
+	unsigned int start;
+
+	if (tb->current_icode < tb->list_area || tb->current_icode >= tb->list_area + tb->list_area_size)
+		return NULL; // direct mode
+
+	offset = tb->current_icode - tb->list_area;
+	entry = find_site(&tb->expression_cache, offset);
+	if (entry == EXPRESSION_NOT_COMPILED)
+	{
+		start = tb->bytecode_length;
+		tb->compile_icode = tb->current_icode;
+		tb->compile_depth = 0;
+		if (b_emit(tb, 0) && b_compile_expression(tb) && b_emit(tb, B_END))
+		{
+			tb->bytecode_area[start] = tb->compile_icode - tb->list_area;
+			entry = start + 2;
+		}
+		else
+		{ // syntax error or no room, leave it to the i-code parser
+			tb->bytecode_length = start;
+			entry = EXPRESSION_NOT_COMPILABLE;
+		}
+		if (!store_site(&tb->expression_cache, offset, entry))
+		{ // no memory, compile it again next time
+			tb->bytecode_length = start;
+			return NULL;
+		}
+	}
+
+	if (entry == EXPRESSION_NOT_COMPILABLE)
+		return NULL;
+	return tb->bytecode_area + entry - 2;
+}
+
+// Bytecode dispatch
+#ifdef THREADED_DISPATCH
+#define OPERATION(code) operation_##code:
+#define NEXT_OPERATION goto *operation_table[*code++]
+#else
+#define OPERATION(code) case code:
+#define NEXT_OPERATION break
+#endif
+
+// Execute bytecode
+static short b_execute(struct tb_context *tb, int *code)
+{
+	short stack[SIZE_BYTECODE_STACK];
+	short *sp; // Stack pointer, point next entry
+#ifdef THREADED_DISPATCH
+	static const void *const operation_table[] = {
+		[B_NUM] = &&operation_B_NUM,
+		[B_VAR] = &&operation_B_VAR,
+		[B_ARRAY] = &&operation_B_ARRAY,
+		[B_RND] = &&operation_B_RND,
+		[B_ABS] = &&operation_B_ABS,
+		[B_SIZE] = &&operation_B_SIZE,
+		[B_NEG] = &&operation_B_NEG,
+		[B_ADD] = &&operation_B_ADD,
+		[B_SUB] = &&operation_B_SUB,
+		[B_MUL] = &&operation_B_MUL,
+		[B_DIV] = &&operation_B_DIV,
+		[B_EQ] = &&operation_B_EQ,
+		[B_SHARP] = &&operation_B_SHARP,
+		[B_LT] = &&operation_B_LT,
+		[B_LTE] = &&operation_B_LTE,
+		[B_GT] = &&operation_B_GT,
+		[B_GTE] = &&operation_B_GTE,
+		[B_END] = &&operation_B_END};
+#endif
+
+	tb->current_icode = tb->list_area + *code++;
+	sp = stack;
+#ifdef THREADED_DISPATCH
+	NEXT_OPERATION;
+#else
+	while (1)
+		switch (*code++)
+		{
+#endif
+		OPERATION(B_NUM)
+			*sp++ = *code++;
+			NEXT_OPERATION;
+		OPERATION(B_VAR)
+			*sp++ = tb->variable_area[*code++];
+			NEXT_OPERATION;
+		OPERATION(B_ARRAY)
+			if (*(sp - 1) < 0 || *(sp - 1) >= tb->array_area_size)
+			{
+				tb->err = ERR_SOR;
+				return -1;
+			}
+			*(sp - 1) = tb->array_area[*(sp - 1)];
+			NEXT_OPERATION;
+		OPERATION(B_RND)
+			*(sp - 1) = get_random_number(tb, *(sp - 1));
+			NEXT_OPERATION;
+		OPERATION(B_ABS)
+			if (*(sp - 1) < 0)
+				*(sp - 1) *= -1;
+			NEXT_OPERATION;
+		OPERATION(B_SIZE)
+			*sp++ = return_free_memory_size(tb);
+			NEXT_OPERATION;
+		OPERATION(B_NEG)
+			*(sp - 1) = 0 - *(sp - 1);
+			NEXT_OPERATION;
+		OPERATION(B_ADD)
+			sp--;
+			*(sp - 1) += *sp;
+			NEXT_OPERATION;
+		OPERATION(B_SUB)
+			sp--;
+			*(sp - 1) -= *sp;
+			NEXT_OPERATION;
+		OPERATION(B_MUL)
+			sp--;
+			*(sp - 1) *= *sp;
+			NEXT_OPERATION;
+		OPERATION(B_DIV)
+			sp--;
+			if (*sp == 0)
+			{
+				tb->err = ERR_DIVBY0;
+				return -1;
+			}
+			*(sp - 1) /= *sp;
+			NEXT_OPERATION;
+		OPERATION(B_EQ)
+			sp--;
+			*(sp - 1) = (*(sp - 1) == *sp);
+			NEXT_OPERATION;
+		OPERATION(B_SHARP)
+			sp--;
+			*(sp - 1) = (*(sp - 1) != *sp);
+			NEXT_OPERATION;
+		OPERATION(B_LT)
+			sp--;
+			*(sp - 1) = (*(sp - 1) < *sp);
+			NEXT_OPERATION;
+		OPERATION(B_LTE)
+			sp--;
+			*(sp - 1) = (*(sp - 1) <= *sp);
+			NEXT_OPERATION;
+		OPERATION(B_GT)
+			sp--;
+			*(sp - 1) = (*(sp - 1) > *sp);
+			NEXT_OPERATION;
+		OPERATION(B_GTE)
+			sp--;
+			*(sp - 1) = (*(sp - 1) >= *sp);
+			NEXT_OPERATION;
+		OPERATION(B_END)
+			return *(sp - 1);
+#ifndef THREADED_DISPATCH
+		}
+#endif
+}
+
+// The parser
+static short i_the_parser(struct tb_context *tb)
+{
+	short value, tmp;
+	int *code;
+	unsigned char *top_of_expression;
+
+	tb->expression_count++;
+	if (tb->engine == TB_ENGINE_BYTECODE && (code = get_compiled_expression(tb)))
+	{
+		top_of_expression = tb->current_icode;
+		value = b_execute(tb, code);
+		if (!tb->err)
+			return value;
+
+		// Evaluate again by i-code, so that the error is the same
+		tb->err = 0;
+		tb->current_icode = top_of_expression;
+	}
+
+	value = i_add_or_subtract_calculation(tb);
+	if (tb->err)
+		return -1;
+
+	// conditional expression
+	while (1)
+		switch (*tb->current_icode)
+		{
+		case I_EQ:
+			tb->current_icode++;
+			tmp = i_add_or_subtract_calculation(tb);
+			value = (value == tmp);
+			break;
+		case I_SHARP:
+			tb->current_icode++;
+			tmp = i_add_or_subtract_calculation(tb);
+			value = (value != tmp);
+			break;
+		case I_LT:
+			tb->current_icode++;
+			tmp = i_add_or_subtract_calculation(tb);
+			value = (value < tmp);
+			break;
+		case I_LTE:
+			tb->current_icode++;
+			tmp = i_add_or_subtract_calculation(tb);
+			value = (value <= tmp);
+			break;
+		case I_GT:
+			tb->current_icode++;
+			tmp = i_add_or_subtract_calculation(tb);
+			value = (value > tmp);
+			break;
+		case I_GTE:
+			tb->current_icode++;
+			tmp = i_add_or_subtract_calculation(tb);
+			value = (value >= tmp);
+			break;
+		default:
+			return value;
+		}
+}
+
+// PRINT handler
+static void i_print_handler(struct tb_context *tb)
+{
+	short value;
+	short len;
+	unsigned char i;
+
+	len = 0;
+	while (*tb->current_icode != I_SEMI && *tb->current_icode != I_EOL)
+	{
+		switch (*tb->current_icode)
+		{
+		case I_STR:
+			tb->current_icode++;
+			i = *tb->current_icode++;
+			c_write(tb, (char *)tb->current_icode, i);
+			tb->current_icode += i;
+			break;
+		case I_SHARP:
+			tb->current_icode++;
+			len = i_the_parser(tb);
+			if (tb->err)
+				return;
+			break;
+		default:
+			value = i_the_parser(tb);
+			if (tb->err)
+				return;
+			print_numeric_specified_columns(tb, value, len);
+			break;
+		}
+
+		if (*tb->current_icode == I_COMMA)
+		{
+			tb->current_icode++;
+			if (*tb->current_icode == I_SEMI || *tb->current_icode == I_EOL)
+				return;
+		}
+		else
+		{
+			if (*tb->current_icode != I_SEMI && *tb->current_icode != I_EOL)
+			{
+				tb->err = ERR_SYNTAX;
+				return;
+			}
+		}
+	}
+	newline(tb);
+}
+
+// INPUT handler
+static void i_input_handler(struct tb_context *tb)
+{
+	short value;
+	short index;
+	unsigned char i;
+	unsigned char prompt;
+
+	while (1)
+	{
+		prompt = 1;
+
+		if (*tb->current_icode == I_STR)
+		{
+			tb->current_icode++;
+			i = *tb->current_icode++;
+			c_write(tb, (char *)tb->current_icode, i);
+			tb->current_icode += i;
+			prompt = 0;
+		}
+
+		switch (*tb->current_icode)
+		{
+		case I_VAR:
+			tb->current_icode++;
+			if (prompt)
+			{
+				c_putch(tb, *tb->current_icode + 'A');
+				c_putch(tb, ':');
+			}
+			value = input_numeric_and_return_value(tb);
+			if (tb->err)
+				return;
+			tb->variable_area[*tb->current_icode++] = value;
+			break;
+		case I_ARRAY:
+			tb->current_icode++;
+			index = get_argument_in_parenthesis(tb);
+			if (tb->err)
+				return;
+			if (index < 0 || index >= tb->array_area_size)
+			{
+				tb->err = ERR_SOR;
+				return;
+			}
+			if (prompt)
+			{
+				c_puts(tb, "@(");
+				print_numeric_specified_columns(tb, index, 0);
+				c_puts(tb, "):");
+			}
+			value = input_numeric_and_return_value(tb);
+			if (tb->err)
+				return;
+			tb->array_area[index] = value;
+			break;
+		default:
+			tb->err = ERR_SYNTAX;
+			return;
+		}
+
+		switch (*tb->current_icode)
+		{
+		case I_COMMA:
+			tb->current_icode++;
+			break;
+		case I_SEMI:
+		case I_EOL:
+			return;
+		default:
+			tb->err = ERR_SYNTAX;
+			return;
+		}
+	}
+}
+
+// Variable assignment handler
+static void i_variable_assignment_handler(struct tb_context *tb)
+{
+	short value;
+	short index;
+
+	index = *tb->current_icode++;
+	if (*tb->current_icode != I_EQ)
+	{
+		tb->err = ERR_VWOEQ;
+		return;
+	}
+	tb->current_icode++;
+
+	value = i_the_parser(tb);
+	if (tb->err)
+		return;
+
+	tb->variable_area[index] = value;
+}
+
+// Array assignment handler
+static void i_array_assignment_handler(struct tb_context *tb)
+{
+	short value;
+	short index;
+
+	index = get_argument_in_parenthesis(tb);
+	if (tb->err)
+		return;
+
+	if (index < 0 || index >= tb->array_area_size)
+	{
+		tb->err = ERR_SOR;
+		return;
+	}
+
+	if (*tb->current_icode != I_EQ)
+	{
+		tb->err = ERR_VWOEQ;
+		return;
+	}
+	tb->current_icode++;
+
+	value = i_the_parser(tb);
+	if (tb->err)
+		return;
+
+	tb->array_area[index] = value;
+}
+
+// LET handler
+static void i_let_handler(struct tb_context *tb)
+{
+	switch (*tb->current_icode)
+	{
+	case I_VAR:
+		tb->current_icode++;
+		i_variable_assignment_handler(tb); // Variable assignment
+		break;
+	case I_ARRAY:
+		tb->current_icode++;
+		i_array_assignment_handler(tb); // Array assignment
+		break;
+	default:
+		tb->err = ERR_LETWOV;
+		break;
+	}
+}
+
+// Check key-in for [ESC]
+// Called when key_pending is set, return 1 and set err if [ESC]
+static unsigned char c_escape(struct tb_context *tb)
+{
+	key_pending = 0;
+	if (c_kbhit())
+	{
+		key_pending = 1; // more key-in may be buffered
+		if (getchar() == 27)
+		{ // ESC ?
+			tb->err = ERR_ESC;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Get target line of GOTO or GOSUB
+// current_icode points GOTO or GOSUB, and is moved past the line number
+static unsigned char *get_branch_target(struct tb_context *tb)
+{
+	short line_number;
+	unsigned char *line_pointer;
+	unsigned int link;
+
+	// Case resolved by RUN
+	if (tb->current_icode >= tb->list_area && tb->current_icode < tb->list_area + tb->list_area_size)
+	{
+		link = find_site(&tb->branch_links, tb->current_icode - tb->list_area);
+		if (link)
+		{
+			tb->current_icode += 4; // skip GOTO/GOSUB and numeric
+			return tb->list_area + link - 1;
+		}
+	}
+
+	tb->current_icode++;
+	line_number = i_the_parser(tb); // get line number
+	if (tb->err)
+		return NULL;
+	line_pointer = search_line_by_line_number(tb, line_number); // search line
+	if (line_number != get_line_number_by_line_pointer(line_pointer))
+	{ // if not found
+		tb->err = ERR_ULN;
+		return NULL;
+	}
+	return line_pointer;
+}
+
+// Trace the statement at the current i-code
+static void trace_statement(struct tb_context *tb)
+{
+	struct trace_record *record = &tb->trace_buffer[tb->trace_count++ & (SIZE_TRACE_BUFFER - 1)];
+
+	if (tb->current_icode >= tb->list_area && tb->current_icode < tb->list_area + tb->list_area_size)
+		record->line = get_line_number_by_line_pointer(tb->current_line);
+	else
+		record->line = 0; // direct command
+	record->icode = *tb->current_icode;
+}
+
+// Get the line after the current one
+// Return NULL in direct mode, where the current line is not run
+static unsigned char *get_next_line(struct tb_context *tb)
+{
+	if (tb->current_icode < tb->list_area || tb->current_icode >= tb->list_area + tb->list_area_size)
+		return NULL; // direct mode
+	return tb->current_line + get_line_length(tb->current_line);
+}
+
+// Statement dispatch
+#ifdef THREADED_DISPATCH
+#define STATEMENT(code) statement_##code:
+#define STATEMENT_DEFAULT statement_default:
+#define NEXT_STATEMENT                                                   \
+	do                                                                   \
+	{                                                                    \
+		while (*tb->current_icode == I_SEMI)                             \
+			tb->current_icode++; /* a separator, not a statement */      \
+		if (*tb->current_icode == I_EOL)                                 \
+			return get_next_line(tb);                                    \
+		if (key_pending && c_escape(tb))                                 \
+			return NULL;                                                 \
+		if (tb->trace_on)                                                \
+			trace_statement(tb);                                         \
+		tb->dispatch_count[*tb->current_icode]++;                        \
+		goto *statement_table[*tb->current_icode];                       \
+	} while (0)
+#define END_STATEMENT                                    \
+	do                                                   \
+	{                                                    \
+		tb->statement_count++;                           \
+		if (tb->err)                                     \
+			return NULL;                                 \
+		if (tb->step_left && !--tb->step_left)           \
+		{ /* no statement left for tb_step */            \
+			tb->step_ended = 1;                          \
+			return NULL;                                 \
+		}                                                \
+		NEXT_STATEMENT;                                  \
+	} while (0)
+#else
+#define STATEMENT(code) case code:
+#define STATEMENT_DEFAULT default:
+#define END_STATEMENT break
+#endif
+
+// Execute a series of i-code
+static unsigned char *i_execute_a_series_of_icode(struct tb_context *tb)
+{
+	unsigned char *line_pointer; // temporary line pointer
+	short index, vto, vstep;	 // FOR-NEXT items
+	struct for_frame *frame;	 // FOR-NEXT frame
+	short condition;			 // IF condition
+
+#ifdef THREADED_DISPATCH
+	static const void *const statement_table[MAX_BYTE_VALUE + 1] = {
+		[I_GOTO] = &&statement_I_GOTO,
+		[I_GOSUB] = &&statement_I_GOSUB,
+		[I_RETURN] = &&statement_I_RETURN,
+		[I_FOR] = &&statement_I_FOR,
+		[I_TO] = &&statement_default,
+		[I_STEP] = &&statement_default,
+		[I_NEXT] = &&statement_I_NEXT,
+		[I_IF] = &&statement_I_IF,
+		[I_REM] = &&statement_I_REM,
+		[I_STOP] = &&statement_I_STOP,
+		[I_INPUT] = &&statement_I_INPUT,
+		[I_PRINT] = &&statement_I_PRINT,
+		[I_LET] = &&statement_I_LET,
+		[I_COMMA] = &&statement_default,
+		[I_SEMI] = &&statement_default, // skipped by NEXT_STATEMENT
+		[I_MINUS] = &&statement_default,
+		[I_PLUS] = &&statement_default,
+		[I_MUL] = &&statement_default,
+		[I_DIV] = &&statement_default,
+		[I_OPEN] = &&statement_default,
+		[I_CLOSE] = &&statement_default,
+		[I_GTE] = &&statement_default,
+		[I_SHARP] = &&statement_default,
+		[I_GT] = &&statement_default,
+		[I_EQ] = &&statement_default,
+		[I_LTE] = &&statement_default,
+		[I_LT] = &&statement_default,
+		[I_ARRAY] = &&statement_I_ARRAY,
+		[I_RND] = &&statement_default,
+		[I_ABS] = &&statement_default,
+		[I_SIZE] = &&statement_default,
+		[I_LIST] = &&statement_I_LIST,
+		[I_RUN] = &&statement_I_RUN,
+		[I_NEW] = &&statement_I_NEW,
+		[I_SYSTEM] = &&statement_default,
+		[I_PROFILE] = &&statement_I_PROFILE,
+		[I_STATS] = &&statement_I_STATS,
+		[I_TRON] = &&statement_I_TRON,
+		[I_TROFF] = &&statement_I_TROFF,
+		[I_SAVE] = &&statement_I_SAVE,
+		[I_LOAD] = &&statement_I_LOAD,
+		[I_NUM] = &&statement_default,
+		[I_VAR] = &&statement_I_VAR,
+		[I_STR] = &&statement_default,
+		[I_EOL] = &&statement_default,
+		[I_EOL + 1 ... MAX_BYTE_VALUE] = &&statement_default};
+
+	NEXT_STATEMENT; // dispatch first statement
+#else
+	while (*tb->current_icode != I_EOL)
+	{
+		if (*tb->current_icode == I_SEMI)
+		{ // a separator, not a statement
+			tb->current_icode++;
+			continue;
+		}
+		if (key_pending && c_escape(tb))
+			return NULL;
+
+		if (tb->trace_on)
+			trace_statement(tb);
+		tb->dispatch_count[*tb->current_icode]++;
+		switch (*tb->current_icode)
+		{
+#endif
+
+		STATEMENT(I_GOTO)
+			line_pointer = get_branch_target(tb); // get target line
+			if (tb->err)
+				END_STATEMENT;
+
+			tb->current_line = line_pointer;	  // update line pointer
+			tb->current_icode = tb->current_line + SIZE_LINE_HEADER; // update i-code pointer
+			END_STATEMENT;
+
+		STATEMENT(I_GOSUB)
+			line_pointer = get_branch_target(tb); // get target line
+			if (tb->err)
+				END_STATEMENT;
+
+			// push pointers
+			if (tb->gosub_stack_index >= SIZE_GOSUB_STACK - 2)
+			{ // stack overflow ?
+				tb->err = ERR_GSTKOF;
+				END_STATEMENT;
+			}
+			tb->gosub_stack[tb->gosub_stack_index++] = tb->current_line;  // push line pointer
+			tb->gosub_stack[tb->gosub_stack_index++] = tb->current_icode; // push i-code pointer
+			if (tb->gosub_stack_index > tb->gosub_stack_high)
+				tb->gosub_stack_high = tb->gosub_stack_index;
+
+			tb->current_line = line_pointer;	  // update line pointer
+			tb->current_icode = tb->current_line + SIZE_LINE_HEADER; // update i-code pointer
+			END_STATEMENT;
+
+		STATEMENT(I_RETURN)
+			if (tb->gosub_stack_index < 2)
+			{ // stack empty ?
+				tb->err = ERR_GSTKUF;
+				END_STATEMENT;
+			}
+			tb->current_icode = tb->gosub_stack[--tb->gosub_stack_index]; // pop line pointer
+			tb->current_line = tb->gosub_stack[--tb->gosub_stack_index];  // pop i-code pointer
+			END_STATEMENT;
+
+		STATEMENT(I_FOR)
+			tb->current_icode++;
+
+			if (*tb->current_icode++ != I_VAR)
+			{ // no variable
+				tb->err = ERR_FORWOV;
+				END_STATEMENT;
+			}
+
+			index = *tb->current_icode;			 // get variable index
+			i_variable_assignment_handler(tb); // variable_area = value
+			if (tb->err)
+				END_STATEMENT;
+
+			if (*tb->current_icode == I_TO)
+			{
+				tb->current_icode++;
+				vto = i_the_parser(tb); // get TO value
+			}
+			else
+			{
+				tb->err = ERR_FORWOTO;
+				END_STATEMENT;
+			}
+
+			if (*tb->current_icode == I_STEP)
+			{
+				tb->current_icode++;
+				vstep = i_the_parser(tb); // get STEP value
+			}
+			else
+				vstep = 1; // default STEP value
+
+			// overflow check
+			if (((vstep < 0) && (-32767 - vstep > vto)) ||
+				((vstep > 0) && (32767 - vstep < vto)))
+			{
+				tb->err = ERR_VOF;
+				END_STATEMENT;
+			}
+
+			// push frame
+			if (tb->for_stack_index >= SIZE_LSTK - 1)
+			{ // stack overflow ?
+				tb->err = ERR_LSTKOF;
+				END_STATEMENT;
+			}
+			frame = &tb->for_stack[tb->for_stack_index++];
+			if (tb->for_stack_index > tb->for_stack_high)
+				tb->for_stack_high = tb->for_stack_index;
+			frame->line = tb->current_line;
+			frame->icode = tb->current_icode;
+			frame->counter = &tb->variable_area[index];
+			frame->step = vstep;
+			frame->index = index;
+			if (vstep > 0)
+			{ // -32768 to TO
+				frame->low = 0x8000;
+				frame->span = vto + 0x8000;
+			}
+			else if (vstep < 0)
+			{ // TO to 32767
+				frame->low = vto;
+				frame->span = 32767 - vto;
+			}
+			else
+			{ // forever
+				frame->low = 0;
+				frame->span = 0xFFFF;
+			}
+			END_STATEMENT;
+
+		STATEMENT(I_NEXT)
+			tb->current_icode++;
+
+			if (tb->for_stack_index == 0)
+			{ // stack empty ?
+				tb->err = ERR_LSTKUF;
+				END_STATEMENT;
+			}
+
+			frame = &tb->for_stack[tb->for_stack_index - 1];
+			if (*tb->current_icode++ != I_VAR)
+			{ // no variable
+				tb->err = ERR_NEXTWOV;
+				END_STATEMENT;
+			}
+			if (*tb->current_icode++ != frame->index)
+			{ // not equal index
+				tb->err = ERR_NEXTUM;
+				END_STATEMENT;
+			}
+
+			*frame->counter += frame->step; // update loop counter
+
+			// loop end
+			if ((unsigned short)(*frame->counter - frame->low) > frame->span)
+			{
+				tb->for_stack_index--; // resume stack
+				END_STATEMENT;
+			}
+
+			// loop continue
+			tb->current_icode = frame->icode;
+			tb->current_line = frame->line;
+			END_STATEMENT;
+
+		STATEMENT(I_IF)
+			tb->current_icode++;
+			condition = i_the_parser(tb); // get condition
+			if (tb->err)
+			{
+				tb->err = ERR_IFWOC;
+				END_STATEMENT;
+			}
+			if (condition) // if true continue
+				END_STATEMENT;
+			// If false, same as REM
+
+		STATEMENT(I_REM)
+			// Seek pointer to I_EOL
+			// No problem even if it points not realy end of line
+			while (*tb->current_icode != I_EOL)
+				tb->current_icode++; // seek end of line
+			END_STATEMENT;
+
+		STATEMENT(I_STOP)
+			tb->statement_count++; // counted here, as it skips END_STATEMENT
+			return tb->list_area + tb->list_length; // end of list
+
+		STATEMENT(I_VAR)
+			tb->current_icode++;
+			i_variable_assignment_handler(tb);
+			END_STATEMENT;
+		STATEMENT(I_ARRAY)
+			tb->current_icode++;
+			i_array_assignment_handler(tb);
+			END_STATEMENT;
+		STATEMENT(I_LET)
+			tb->current_icode++;
+			i_let_handler(tb);
+			END_STATEMENT;
+		STATEMENT(I_PRINT)
+			tb->current_icode++;
+			i_print_handler(tb);
+			END_STATEMENT;
+		STATEMENT(I_INPUT)
+			tb->current_icode++;
+			i_input_handler(tb);
+			END_STATEMENT;
+
+		STATEMENT(I_TRON)
+			tb->current_icode++;
+			tb->trace_on = 1;
+			END_STATEMENT;
+		STATEMENT(I_TROFF)
+			tb->current_icode++;
+			tb->trace_on = 0;
+			END_STATEMENT;
+
+		STATEMENT(I_LIST)
+		STATEMENT(I_NEW)
+		STATEMENT(I_PROFILE)
+		STATEMENT(I_STATS)
+		STATEMENT(I_SAVE)
+		STATEMENT(I_LOAD)
+		STATEMENT(I_RUN)
+			tb->err = ERR_COM;
+			END_STATEMENT;
+
+		STATEMENT_DEFAULT
+			tb->err = ERR_SYNTAX;
+			END_STATEMENT;
+#ifndef THREADED_DISPATCH
+		}
+
+		tb->statement_count++;
+		if (tb->err)
+			return NULL;
+		if (tb->step_left && !--tb->step_left)
+		{ // no statement left for tb_step
+			tb->step_ended = 1;
+			return NULL;
+		}
+	}
+	return get_next_line(tb);
+#endif
+}
+
+// Go on running from the current i-code
+// Stops at the end of the program, an error, or when tb_step has no
+// statement left
+static void continue_run(struct tb_context *tb)
+{
+	unsigned char *line_pointer;
+
+	while (get_line_length(tb->current_line))
+	{
+		line_pointer = i_execute_a_series_of_icode(tb);
+		if (tb->err || tb->step_ended)
+			return;
+		tb->current_line = line_pointer;
+		tb->current_icode = tb->current_line + SIZE_LINE_HEADER; // not used at end of list
+	}
+}
+
+// RUN command handler
+static void i_run_command_handler(struct tb_context *tb)
+{
+	tb->gosub_stack_index = 0;
+	tb->for_stack_index = 0;
+	resolve_branch_links(tb);
+	tb->current_line = tb->list_area;
+	tb->current_icode = tb->current_line + SIZE_LINE_HEADER;
+	continue_run(tb);
+}
+
+// PROFILE RUN command handler
+// Runs the program 1 statement at a time, by the step limit of tb_step, and
+// records for each line the runs from its first statement and the time
+// spent in its statements. RUN does none of this, so it costs nothing
+// unless asked for.
+static void i_profile_run_handler(struct tb_context *tb)
+{
+	unsigned char *line_pointer;
+	short line_number;
+	struct timespec start, end;
+
+	if (!tb->profile_count)
+	{
+		tb->profile_count = malloc(SIZE_LINE_NUMBERS * sizeof(*tb->profile_count));
+		tb->profile_time = malloc(SIZE_LINE_NUMBERS * sizeof(*tb->profile_time));
+		if (!tb->profile_count || !tb->profile_time)
+		{ // no memory
+			free(tb->profile_count);
+			free(tb->profile_time);
+			tb->profile_count = NULL;
+			tb->profile_time = NULL;
+			tb->err = ERR_LBUFOF;
+			return;
+		}
+	}
+	memset(tb->profile_count, 0, SIZE_LINE_NUMBERS * sizeof(*tb->profile_count));
+	memset(tb->profile_time, 0, SIZE_LINE_NUMBERS * sizeof(*tb->profile_time));
+
+	tb->gosub_stack_index = 0;
+	tb->for_stack_index = 0;
+	resolve_branch_links(tb);
+	tb->current_line = tb->list_area;
+	tb->current_icode = tb->current_line + SIZE_LINE_HEADER;
+	while (get_line_length(tb->current_line))
+	{
+		line_number = get_line_number_by_line_pointer(tb->current_line);
+		if (tb->current_icode == tb->current_line + SIZE_LINE_HEADER)
+			tb->profile_count[line_number]++; // line entered
+		tb->step_left = 1;
+		tb->step_ended = 0;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		line_pointer = i_execute_a_series_of_icode(tb);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		tb->profile_time[line_number] += (end.tv_sec - start.tv_sec) * 1000000000LL + end.tv_nsec - start.tv_nsec;
+		if (tb->err)
+			break;
+		if (!tb->step_ended)
+		{ // end of line
+			tb->current_line = line_pointer;
+			tb->current_icode = tb->current_line + SIZE_LINE_HEADER;
+		}
+	}
+	tb->step_left = 0;
+	tb->step_ended = 0;
+}
+
+// Line in the profile report
+struct profile_record
+{
+	unsigned char *line;	// line pointer
+	unsigned long long time; // nanoseconds
+};
+
+// Compare profile records by time, most first, then by line order
+static int compare_profile_records(const void *a, const void *b)
+{
+	const struct profile_record *record_a = a;
+	const struct profile_record *record_b = b;
+
+	if (record_a->time != record_b->time)
+		return record_a->time < record_b->time ? 1 : -1;
+	return record_a->line < record_b->line ? -1 : record_a->line > record_b->line;
+}
+
+// PROFILE LIST command handler
+// Lists the lines run by the last PROFILE RUN, most time first, each after
+// its share of the time, runs and microseconds
+static void i_profile_list_handler(struct tb_context *tb)
+{
+	struct profile_record *record;
+	unsigned char *line_pointer;
+	unsigned int i, count = 0;
+	unsigned long long total_time = 0;
+	short line_number;
+	char text[64];
+
+	if (!tb->profile_count)
+		return; // not profiled yet
+	record = malloc((tb->line_index_count + 1) * sizeof(*record));
+	if (!record)
+	{
+		tb->err = ERR_LBUFOF;
+		return;
+	}
+	for (line_pointer = tb->list_area; get_line_length(line_pointer); line_pointer += get_line_length(line_pointer))
+	{
+		line_number = get_line_number_by_line_pointer(line_pointer);
+		if (tb->profile_count[line_number] || tb->profile_time[line_number])
+		{
+			record[count].line = line_pointer;
+			record[count++].time = tb->profile_time[line_number];
+			total_time += tb->profile_time[line_number];
+		}
+	}
+	qsort(record, count, sizeof(*record), compare_profile_records);
+
+	for (i = 0; i < count; i++)
+	{
+		line_number = get_line_number_by_line_pointer(record[i].line);
+		sprintf(text, "%5.1f%% %10lu %10llu ",
+				total_time ? 100.0 * record[i].time / total_time : 0.0,
+				tb->profile_count[line_number], record[i].time / 1000);
+		c_puts(tb, text);
+		print_numeric_specified_columns(tb, line_number, 0);
+		c_putch(tb, ' ');
+		listing_1_line_of_icode(tb, get_source_icode(record[i].line));
+		if (tb->err)
+			break;
+		newline(tb);
+	}
+	free(record);
+}
+
+// Name of i-code for counters
+static const char *get_icode_name(unsigned char code)
+{
+	static const char *const name[] = {"NUM", "VAR", "STR", "EOL"};
+
+	if (code < SIZE_KEYWORD_TABLE)
+		return keyword_table[code];
+	if (code <= I_EOL)
+		return name[code - I_NUM];
+	return "?";
+}
+
+// STATS command handler
+// Prints the counters since the interpreter was made
+static void i_stats_handler(struct tb_context *tb)
+{
+	unsigned int i;
+	char text[64];
+
+	sprintf(text, "STATEMENTS %lu", tb->statement_count);
+	c_puts(tb, text);
+	newline(tb);
+	for (i = 0; i <= MAX_BYTE_VALUE; i++)
+		if (tb->dispatch_count[i])
+		{
+			sprintf(text, "DISPATCH %s %lu", get_icode_name(i), tb->dispatch_count[i]);
+			c_puts(tb, text);
+			newline(tb);
+		}
+	sprintf(text, "LINE SEARCHES %lu PROBES %lu", tb->line_search_count, tb->line_probe_count);
+	c_puts(tb, text);
+	newline(tb);
+	sprintf(text, "EXPRESSIONS %lu", tb->expression_count);
+	c_puts(tb, text);
+	newline(tb);
+	sprintf(text, "GOSUB DEPTH %u", tb->gosub_stack_high / 2);
+	c_puts(tb, text);
+	newline(tb);
+	sprintf(text, "FOR DEPTH %u", tb->for_stack_high);
+	c_puts(tb, text);
+	newline(tb);
+	sprintf(text, "LIST BYTES %u", tb->list_length_high);
+	c_puts(tb, text);
+	newline(tb);
+}
+
+// Hardware performance counters
+// With the perf_counters option, every RUN counts hardware events of its
+// thread in user space by perf_event_open, and reports them after the run
+// in all and per statement. An event the kernel or the machine does not
+// give is reported as N/A, so the run goes on as usual without them.
+struct perf_counter_event
+{
+	const char *name;		   // name in report
+	unsigned int type;		   // perf event type
+	unsigned long long config; // perf event
+};
+
+static const struct perf_counter_event perf_counter_events[] = {
+	{"INSTRUCTIONS", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+	{"CYCLES", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+	{"BRANCH MISSES", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+	{"L1D MISSES", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16},
+	{"LLC MISSES", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}};
+
+#define SIZE_PERF_COUNTERS (sizeof(perf_counter_events) / sizeof(*perf_counter_events))
+
+// Open a counter, disabled
+// Return file descriptor, or -1 with errno
+static int open_perf_counter(const struct perf_counter_event *event)
+{
+	struct perf_event_attr attribute;
+
+	memset(&attribute, 0, sizeof(attribute));
+	attribute.size = sizeof(attribute);
+	attribute.type = event->type;
+	attribute.config = event->config;
+	attribute.disabled = 1;
+	attribute.exclude_kernel = 1; // allowed by perf_event_paranoid up to 2
+	attribute.exclude_hv = 1;
+	return syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0);
+}
+
+// RUN with hardware counters
+static void i_run_with_perf_counters(struct tb_context *tb)
+{
+	int file[SIZE_PERF_COUNTERS];
+	unsigned long long value;
+	unsigned long statements;
+	unsigned int i;
+	int open_error = 0;
+	char text[80];
+
+	for (i = 0; i < SIZE_PERF_COUNTERS; i++)
+	{
+		file[i] = open_perf_counter(&perf_counter_events[i]);
+		if (file[i] < 0)
+			open_error = errno;
+	}
+	for (i = 0; i < SIZE_PERF_COUNTERS; i++)
+		if (file[i] >= 0)
+			ioctl(file[i], PERF_EVENT_IOC_ENABLE, 0);
+	statements = tb->statement_count;
+
+	i_run_command_handler(tb);
+
+	for (i = 0; i < SIZE_PERF_COUNTERS; i++)
+		if (file[i] >= 0)
+			ioctl(file[i], PERF_EVENT_IOC_DISABLE, 0);
+	statements = tb->statement_count - statements;
+
+	newline(tb);
+	sprintf(text, "PERF STATEMENTS %lu", statements);
+	c_puts(tb, text);
+	newline(tb);
+	for (i = 0; i < SIZE_PERF_COUNTERS; i++)
+	{
+		if (file[i] >= 0 && read(file[i], &value, sizeof(value)) == sizeof(value))
+			sprintf(text, "PERF %s %llu %.2f/STATEMENT", perf_counter_events[i].name, value,
+					statements ? (double)value / statements : 0.0);
+		else
+			sprintf(text, "PERF %s N/A", perf_counter_events[i].name);
+		c_puts(tb, text);
+		newline(tb);
+		if (file[i] >= 0)
+			close(file[i]);
+	}
+	if (open_error)
+	{ // tell why
+		c_puts(tb, "PERF N/A: ");
+		c_puts(tb, strerror(open_error));
+		newline(tb);
+	}
+}
+
+// Sampling profiler
+// With a sample file, every RUN sets a timer on the CPU time of its thread
+// that raises SIGPROF, and the handler adds the stack of line numbers, the
+// GOSUB lines and the current line, to a table of counts by stack. After
+// the run, the table is written to the file as folded stacks, a stack and
+// its count on each line (such as "100;200;210 42"), the input of
+// flamegraph.pl. The samples of every run since tb_create add up.
+// SIGPROF from anything other than the sampling timers goes on to the
+// handler the host had set before.
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid // not named by older C libraries
+#endif
+
+static __thread struct tb_context *sampled_context; // Context run on this thread, or NULL
+static struct sigaction host_sigprof_action;		// SIGPROF handler set before
+static char sigprof_timer_tag;						// Its address tells the sampling timers' signals
+
+static void c_sigprof_handler(int signal_number, siginfo_t *info, void *ucontext)
+{
+	struct tb_context *tb = sampled_context;
+	struct sample_record stack, *record;
+	unsigned int i, hash;
+	unsigned char index;
+
+	if (info->si_code != SI_TIMER || info->si_value.sival_ptr != &sigprof_timer_tag)
+	{ // not ours
+		if (host_sigprof_action.sa_flags & SA_SIGINFO)
+			host_sigprof_action.sa_sigaction(signal_number, info, ucontext);
+		else if (host_sigprof_action.sa_handler != SIG_DFL && host_sigprof_action.sa_handler != SIG_IGN)
+			host_sigprof_action.sa_handler(signal_number);
+		return;
+	}
+	if (!tb)
+		return; // left pending by a run that has ended
+
+	// Take the stack, as it may change under the handler
+	index = tb->gosub_stack_index & ~1; // whole frames only
+	stack.depth = 0;
+	for (i = 0; i < index; i += 2)
+		stack.line[stack.depth++] = get_line_number_by_line_pointer(tb->gosub_stack[i]);
+	stack.line[stack.depth++] = get_line_number_by_line_pointer(tb->current_line);
+
+	hash = stack.depth;
+	for (i = 0; i < stack.depth; i++)
+		hash = hash * 31 + stack.line[i];
+	for (i = 0; i < SIZE_SAMPLE_TABLE; i++)
+	{
+		record = &tb->sample_table[(hash + i) % SIZE_SAMPLE_TABLE];
+		if (!record->count)
+		{ // new stack
+			memcpy(record->line, stack.line, sizeof(stack.line));
+			record->depth = stack.depth;
+		}
+		else if (record->depth != stack.depth || memcmp(record->line, stack.line, stack.depth * sizeof(*stack.line)))
+			continue;
+		record->count++;
+		return;
+	}
+	tb->sample_dropped++; // table full
+}
+
+static pthread_once_t sigprof_handler_once = PTHREAD_ONCE_INIT; // SIGPROF handler is set
+
+static void c_init_sigprof_handler(void)
+{
+	struct sigaction action;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = c_sigprof_handler;
+	action.sa_flags = SA_RESTART | SA_SIGINFO;
+	sigaction(SIGPROF, &action, &host_sigprof_action);
+}
+
+// Write the sample table to the sample file
+// Return 0 with errno if it can't be written
+static unsigned char write_sample_file(struct tb_context *tb)
+{
+	FILE *file;
+	unsigned int i;
+	unsigned char j;
+
+	file = fopen(tb->sample_file_name, "w");
+	if (!file)
+		return 0;
+	for (i = 0; i < SIZE_SAMPLE_TABLE; i++)
+		if (tb->sample_table[i].count)
+		{
+			for (j = 0; j < tb->sample_table[i].depth; j++)
+				fprintf(file, j ? ";%d" : "%d", tb->sample_table[i].line[j]);
+			fprintf(file, " %lu\n", tb->sample_table[i].count);
+		}
+	if (tb->sample_dropped)
+		fprintf(file, "[dropped] %lu\n", tb->sample_dropped);
+	return fclose(file) == 0;
+}
+
+// Write the trace to the trace file
+// A header of "TTBT", version 1 (2 bytes), entry size 3 (2 bytes) and
+// entry count (4 bytes), all little endian, followed by the entries oldest
+// first, each line number (2 bytes) and statement i-code (1 byte)
+// Return 0 with errno if it can't be written
+static unsigned char write_trace_file(struct tb_context *tb)
+{
+	FILE *file;
+	unsigned char header[12], entry[3];
+	unsigned long i, count;
+
+	count = tb->trace_count < SIZE_TRACE_BUFFER ? tb->trace_count : SIZE_TRACE_BUFFER;
+	file = fopen(tb->trace_file_name, "wb");
+	if (!file)
+		return 0;
+	memcpy(header, "TTBT", 4);
+	image_put(header + 4, 1, 2);
+	image_put(header + 6, sizeof(entry), 2);
+	image_put(header + 8, count, 4);
+	fwrite(header, 1, sizeof(header), file);
+	for (i = tb->trace_count - count; i < tb->trace_count; i++)
+	{
+		image_put(entry, tb->trace_buffer[i & (SIZE_TRACE_BUFFER - 1)].line, 2);
+		entry[2] = tb->trace_buffer[i & (SIZE_TRACE_BUFFER - 1)].icode;
+		fwrite(entry, 1, sizeof(entry), file);
+	}
+	return fclose(file) == 0;
+}
+
+// Print the last traced statements
+static void print_trace(struct tb_context *tb)
+{
+	unsigned long i, count;
+
+	count = tb->trace_count - tb->trace_start < SIZE_TRACE_DUMP ? tb->trace_count - tb->trace_start : SIZE_TRACE_DUMP;
+	for (i = tb->trace_count - count; i < tb->trace_count; i++)
+	{
+		c_puts(tb, "TRACE ");
+		print_numeric_specified_columns(tb, tb->trace_buffer[i & (SIZE_TRACE_BUFFER - 1)].line, 0);
+		c_putch(tb, ' ');
+		c_puts(tb, get_icode_name(tb->trace_buffer[i & (SIZE_TRACE_BUFFER - 1)].icode));
+		newline(tb);
+	}
+}
+
+// RUN, with the hardware counters, the sampler and the trace file if asked for
+static void run_program(struct tb_context *tb)
+{
+	struct sigevent event;
+	struct itimerspec interval;
+	timer_t timer;
+	unsigned char sampling = 0;
+
+	tb->trace_count = tb->trace_start = 0; // trace this run only
+	if (tb->sample_file_name)
+	{
+		if (!tb->sample_table)
+			tb->sample_table = calloc(SIZE_SAMPLE_TABLE, sizeof(*tb->sample_table));
+		pthread_once(&sigprof_handler_once, c_init_sigprof_handler);
+		memset(&event, 0, sizeof(event));
+		event.sigev_notify = SIGEV_THREAD_ID;
+		event.sigev_signo = SIGPROF;
+		event.sigev_value.sival_ptr = &sigprof_timer_tag;
+		event.sigev_notify_thread_id = syscall(SYS_gettid); // this thread only
+		memset(&interval, 0, sizeof(interval));
+		interval.it_value.tv_sec = interval.it_interval.tv_sec = tb->sample_interval / 1000000;
+		interval.it_value.tv_nsec = interval.it_interval.tv_nsec = tb->sample_interval % 1000000 * 1000;
+		if (tb->sample_table && timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &timer) == 0)
+		{
+			sampled_context = tb;
+			timer_settime(timer, 0, &interval, NULL);
+			sampling = 1;
+		}
+		else
+		{ // run without
+			c_puts(tb, "SAMPLE N/A: ");
+			c_puts(tb, tb->sample_table ? strerror(errno) : "no memory");
+			newline(tb);
+		}
+	}
+
+	if (tb->perf_counters)
+		i_run_with_perf_counters(tb);
+	else
+		i_run_command_handler(tb);
+
+	if (sampling)
+	{
+		timer_delete(timer);
+		sampled_context = NULL;
+		if (!write_sample_file(tb))
+		{
+			c_puts(tb, "SAMPLE N/A: ");
+			c_puts(tb, strerror(errno));
+			newline(tb);
+		}
+	}
+	if (tb->trace_file_name && tb->trace_count && !write_trace_file(tb))
+	{
+		c_puts(tb, "TRACE N/A: ");
+		c_puts(tb, strerror(errno));
+		newline(tb);
+	}
+}
+
+// SAVE and LOAD command handler
+// current_icode points the file name after SAVE or LOAD
+static void i_image_file_handler(struct tb_context *tb, unsigned char code)
+{
+	char file_name[MAX_BYTE_VALUE + 1];
+	unsigned char len;
+
+	if (*tb->current_icode != I_STR || *(tb->current_icode + 2 + *(tb->current_icode + 1)) != I_EOL)
+	{ // no file name
+		tb->err = ERR_SYNTAX;
+		return;
+	}
+	len = *(tb->current_icode + 1);
+	memcpy(file_name, tb->current_icode + 2, len);
+	file_name[len] = 0;
+
+	if (code == I_SAVE)
+	{
+		if (tb_save_image_file(tb, file_name) != TB_OK)
+			tb->err = ERR_FILE;
+	}
+	else if (tb_load_image_file(tb, file_name) != TB_OK)
+		tb->err = errno == EINVAL ? ERR_IMAGE : ERR_FILE;
+}
+
+// LIST command handler
+static void i_list_handler(struct tb_context *tb)
+{
+	short line_number;
+
+	line_number = (*tb->current_icode == I_NUM) ? *(tb->current_icode + 1) | *(tb->current_icode + 2) << BITS_IN_BYTE : 0;
+
+	tb->current_line = search_line_by_line_number(tb, line_number);
+
+	while (get_line_length(tb->current_line))
+	{
+		print_numeric_specified_columns(tb, get_line_number_by_line_pointer(tb->current_line), 0);
+		c_putch(tb, ' ');
+		listing_1_line_of_icode(tb, get_source_icode(tb->current_line));
+		if (tb->err)
+			break;
+		newline(tb);
+		tb->current_line += get_line_length(tb->current_line);
+	}
+}
+
+// NEW command handler
+static void i_new_command_handler(struct tb_context *tb)
+{
+	unsigned char i;
+
+	for (i = 0; i < 26; i++)
+		tb->variable_area[i] = 0;
+	if (!tb->array_area_mapped) // a mapped array keeps its file
+		memset(tb->array_area, 0, tb->array_area_size * sizeof(*tb->array_area));
+	tb->gosub_stack_index = 0;
+	tb->for_stack_index = 0;
+	if (!reserve_list_area(tb, SIZE_LIST_BUFFER))
+	{ // no memory to start
+		tb->err = ERR_LBUFOF;
+		return;
+	}
+	*tb->list_area = *(tb->list_area + 1) = 0;
+	rebuild_line_index(tb);
+	drop_branch_links(tb);
+	drop_expression_cache(tb);
+	tb->current_line = tb->list_area;
+}
+
+// Command processor
+static void i_command_processor(struct tb_context *tb)
+{
+	tb->current_icode = tb->icode_conversion_buffer;
+	switch (*tb->current_icode)
+	{
+	case I_NEW:
+		tb->current_icode++;
+		if (*tb->current_icode == I_EOL)
+			i_new_command_handler(tb);
+		else
+			tb->err = ERR_SYNTAX;
+		break;
+	case I_LIST:
+		tb->current_icode++;
+		if (*tb->current_icode == I_EOL || *(tb->current_icode + 3) == I_EOL)
+			i_list_handler(tb);
+		else
+			tb->err = ERR_SYNTAX;
+		break;
+	case I_RUN:
+		tb->current_icode++;
+		run_program(tb);
+		break;
+	case I_SAVE:
+	case I_LOAD:
+		tb->current_icode++;
+		i_image_file_handler(tb, *tb->icode_conversion_buffer);
+		break;
+	case I_STATS:
+		tb->current_icode++;
+		if (*tb->current_icode == I_EOL)
+			i_stats_handler(tb);
+		else
+			tb->err = ERR_SYNTAX;
+		break;
+	case I_PROFILE:
+		tb->current_icode++;
+		if (*tb->current_icode == I_RUN && *(tb->current_icode + 1) == I_EOL)
+			i_profile_run_handler(tb);
+		else if (*tb->current_icode == I_LIST && *(tb->current_icode + 1) == I_EOL)
+			i_profile_list_handler(tb);
+		else
+			tb->err = ERR_SYNTAX;
+		break;
+	default:
+		i_execute_a_series_of_icode(tb);
+		break;
+	}
+}
+
+// Print OK or error message
+static void error(struct tb_context *tb)
+{
+	if (tb->batch_mode && !tb->err)
+		return;
+
+	if (tb->err)
+	{
+		if (tb->current_icode >= tb->list_area && tb->current_icode < tb->list_area + tb->list_area_size && get_line_length(tb->current_line))
+		{
+			newline(tb);
+			c_puts(tb, "LINE:");
+			print_numeric_specified_columns(tb, get_line_number_by_line_pointer(tb->current_line), 0);
+			c_putch(tb, ' ');
+			listing_1_line_of_icode(tb, get_source_icode(tb->current_line));
+		}
+		else
+		{
+			newline(tb);
+			c_puts(tb, "YOU TYPE: ");
+			c_puts(tb, tb->command_line_buffer);
+		}
+	}
+
+	newline(tb);
+	c_puts(tb, errmsg[tb->err]);
+	newline(tb);
+	if (tb->err && tb->trace_on)
+		print_trace(tb); // how it came here
+	if (tb->err)
+		c_flush(tb);
+	tb->err = 0;
+}
+
+// Program image
+// A header of "TTBI", version (2 bytes), 0 (2 bytes), list length
+// (4 bytes) and checksum of the list (4 bytes), all little endian,
+// followed by the list area without the end of list. The version changes
+// whenever the i-code or line record does.
+#define IMAGE_VERSION 5
+#define SIZE_IMAGE_HEADER 16
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+// Checksum of bytes (FNV-1a)
+static unsigned int image_checksum(const unsigned char *data, unsigned int len)
+{
+	unsigned int hash = FNV_OFFSET_BASIS;
+
+	while (len--)
+		hash = (hash ^ *data++) * FNV_PRIME;
+	return hash;
+}
+
+static void image_put(unsigned char *p, unsigned int value, unsigned char len)
+{
+	while (len--)
+	{
+		*p++ = value & MAX_BYTE_VALUE;
+		value >>= BITS_IN_BYTE;
+	}
+}
+
+static unsigned int image_get(const unsigned char *p, unsigned char len)
+{
+	unsigned int value = 0;
+
+	while (len--)
+		value = value << BITS_IN_BYTE | p[len];
+	return value;
+}
+
+// Check i-code from ip up to I_EOL, before end
+// Every byte must be an i-code, and every operand inside
+// Return the pointer after I_EOL, or NULL if the i-code is broken
+static const unsigned char *check_icode(const unsigned char *ip, const unsigned char *end)
+{
+	unsigned int size;
+
+	while (ip < end && *ip != I_EOL)
+	{
+		if (*ip > I_EOL)
+			return NULL; // not an i-code
+		if ((*ip == I_STR || *ip == I_REM) && end - ip < 2)
+			return NULL; // no length
+		if (*ip == I_VAR && end - ip >= 2 && *(ip + 1) >= 26)
+			return NULL; // not a variable
+		size = get_next_icode((unsigned char *)ip) - ip;
+		if (size > (unsigned int)(end - ip))
+			return NULL; // operand out of line
+		ip += size;
+	}
+	if (ip >= end)
+		return NULL; // no I_EOL
+	return ip + 1;
+}
+
+// Check that the list is made of whole lines in line number order
+// Each line is i-code ending with I_EOL, and may be followed by its source
+// i-code, which must end with I_EOL at the end of the line
+static unsigned char check_list(const unsigned char *list, unsigned int len)
+{
+	unsigned int offset, line_length;
+	short line_number, last_number = 0;
+	const unsigned char *line_end, *ip;
+
+	for (offset = 0; offset < len; offset += line_length)
+	{
+		if (len - offset < SIZE_LINE_MIN)
+			return 0;
+		line_length = image_get(list + offset, 2);
+		line_number = image_get(list + offset + 2, 2);
+		if (line_length < SIZE_LINE_MIN || line_length > len - offset ||
+			line_number <= last_number || list[offset + line_length - 1] != I_EOL)
+			return 0;
+		last_number = line_number;
+
+		line_end = list + offset + line_length;
+		ip = check_icode(list + offset + SIZE_LINE_HEADER, line_end);
+		if (ip && ip < line_end)
+			ip = check_icode(ip, line_end); // source i-code
+		if (ip != line_end)
+			return 0;
+	}
+	return 1;
+}
+
+// Library interface
+
+static pthread_once_t keyword_trie_once = PTHREAD_ONCE_INIT; // Keyword trie is built
+
+TB_API tb_context *tb_create(const struct tb_options *options)
+{
+	static const struct tb_options default_options;
+	struct tb_context *tb;
+
+	if (!options)
+		options = &default_options;
+	pthread_once(&keyword_trie_once, build_keyword_trie); // for token conversion
+
+	tb = calloc(1, sizeof(*tb));
+	if (!tb)
+		return NULL;
+	tb->engine = options->engine;
+	tb->perf_counters = options->perf_counters;
+	tb->sample_file_name = options->sample_file_name;
+	tb->trace_file_name = options->trace_file_name;
+	tb->sample_interval = options->sample_interval ? options->sample_interval : SAMPLE_INTERVAL;
+	tb->output = options->output;
+	tb->output_user = options->output_user;
+	tb->input = options->input;
+	tb->input_user = options->input_user;
+	tb->batch_mode = 1;						 // no prompt unless tb_repl
+	tb->random_seed = (unsigned int)time(0); // for RND function
+	c_init_output(tb, options->flush_policy); // for buffered output
+	if (!init_array_area(tb, options->array_size, options->array_file_name))
+	{
+		free(tb);
+		return NULL;
+	}
+	i_new_command_handler(tb);
+	if (tb->err)
+	{
+		tb_destroy(tb);
+		return NULL;
+	}
+	return tb;
+}
+
+TB_API void tb_destroy(tb_context *tb)
+{
+	c_flush(tb);
+	if (tb->array_area_mapped)
+		munmap(tb->array_area, tb->array_area_size * sizeof(*tb->array_area));
+	else
+		free(tb->array_area);
+	free(tb->list_area);
+	free(tb->line_index_number);
+	free(tb->line_index_offset);
+	free(tb->branch_links.entry);
+	free(tb->load_area);
+	free(tb->load_index);
+	free(tb->bytecode_area);
+	free(tb->expression_cache.entry);
+	free(tb->sample_table);
+	free(tb->profile_count);
+	free(tb->profile_time);
+	free(tb);
+}
+
+TB_API int tb_load_source(tb_context *tb, const char *text, size_t len)
+{
+	const char *text_pointer;
+	unsigned short icode_length;
+	int result = TB_OK;
+
+	tb->running = 0;
+	for (text_pointer = text; text_pointer < text + len && !tb->err;)
+	{
+		text_pointer = c_copy_line(tb, text_pointer, text + len);
+		tb->trace_start = tb->trace_count; // dump this command's trace only
+		icode_length = convert_token_to_icode(tb); // Convert token to i-code
+		if (tb->err)
+			break;
+
+		// Quit if i-code is "SYSTEM"
+		if (*tb->icode_conversion_buffer == I_SYSTEM)
+		{
+			result = TB_SYSTEM;
+			break;
+		}
+
+		// If the line starts with a number, store i-code in load area
+		if (*tb->icode_conversion_buffer == I_NUM)
+		{
+			load_icode_to_the_batch_preconditions(tb, icode_length);
+			continue;
+		}
+
+		load_batch_to_the_list(tb); // Direct command sees lines before it
+		if (!tb->err)
+			i_command_processor(tb); // Execute direct
+	}
+	load_batch_to_the_list(tb); // lines read before an error are kept too
+
+	if (tb->err)
+	{
+		error(tb); // Print error message
+		return TB_ERROR;
+	}
+	c_flush(tb);
+	return result;
+}
+
+TB_API size_t tb_save_image(tb_context *tb, void *image, size_t size)
+{
+	unsigned char *p = image;
+
+	if (size >= SIZE_IMAGE_HEADER + tb->list_length)
+	{
+		memcpy(p, "TTBI", 4);
+		image_put(p + 4, IMAGE_VERSION, 2);
+		image_put(p + 6, 0, 2);
+		image_put(p + 8, tb->list_length, 4);
+		image_put(p + 12, image_checksum(tb->list_area, tb->list_length), 4);
+		memcpy(p + SIZE_IMAGE_HEADER, tb->list_area, tb->list_length);
+	}
+	return SIZE_IMAGE_HEADER + tb->list_length;
+}
+
+TB_API int tb_load_image(tb_context *tb, const void *image, size_t len)
+{
+	const unsigned char *p = image;
+	unsigned int list_length;
+
+	tb->running = 0;
+	if (len < SIZE_IMAGE_HEADER || memcmp(p, "TTBI", 4) != 0 || image_get(p + 4, 2) != IMAGE_VERSION)
+		return TB_ERROR;
+	list_length = image_get(p + 8, 4);
+	if (list_length != len - SIZE_IMAGE_HEADER || list_length > SIZE_LIST_MAX - 2 ||
+		image_get(p + 12, 4) != image_checksum(p + SIZE_IMAGE_HEADER, list_length) ||
+		!check_list(p + SIZE_IMAGE_HEADER, list_length) ||
+		!reserve_list_area(tb, list_length + 2))
+		return TB_ERROR;
+
+	drop_branch_links(tb);
+	drop_expression_cache(tb);
+	tb->gosub_stack_index = 0; // pointers in the stacks may move
+	tb->for_stack_index = 0;
+	memcpy(tb->list_area, p + SIZE_IMAGE_HEADER, list_length);
+	*(tb->list_area + list_length) = *(tb->list_area + list_length + 1) = 0; // end of list
+	rebuild_line_index(tb);
+	tb->current_line = tb->list_area;
+	return TB_OK;
+}
+
+TB_API int tb_save_image_file(tb_context *tb, const char *file_name)
+{
+	unsigned char *image;
+	size_t size;
+	FILE *file;
+	int result = TB_OK;
+
+	size = tb_save_image(tb, NULL, 0);
+	image = malloc(size);
+	if (!image)
+	{
+		errno = ENOMEM;
+		return TB_ERROR;
+	}
+	tb_save_image(tb, image, size);
+	file = fopen(file_name, "wb");
+	if (!file || fwrite(image, 1, size, file) != size)
+		result = TB_ERROR;
+	if (file && fclose(file))
+		result = TB_ERROR;
+	free(image);
+	return result;
+}
+
+TB_API int tb_load_image_file(tb_context *tb, const char *file_name)
+{
+	int file;
+	struct stat file_status;
+	void *image;
+	int result;
+
+	file = open(file_name, O_RDONLY);
+	if (file < 0)
+		return TB_ERROR;
+	if (fstat(file, &file_status) < 0)
+	{
+		close(file);
+		return TB_ERROR;
+	}
+	if (file_status.st_size < SIZE_IMAGE_HEADER || file_status.st_size > SIZE_LIST_MAX + SIZE_IMAGE_HEADER)
+	{ // can't be an image
+		close(file);
+		errno = EINVAL;
+		return TB_ERROR;
+	}
+	image = mmap(NULL, file_status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file); // the mapping stays
+	if (image == MAP_FAILED)
+		return TB_ERROR;
+
+	result = tb_load_image(tb, image, file_status.st_size);
+	munmap(image, file_status.st_size);
+	if (result != TB_OK)
+		errno = EINVAL;
+	return result;
+}
+
+TB_API int tb_run(tb_context *tb)
+{
+	tb->running = 0;
+	run_program(tb);
+	if (tb->err)
+	{
+		error(tb); // Print error message
+		return TB_ERROR;
+	}
+	c_flush(tb);
+	return TB_OK;
+}
+
+TB_API int tb_step(tb_context *tb, unsigned long n)
+{
+	if (!n)
+		return tb->running ? TB_RUNNING : TB_OK;
+
+	tb->step_left = n;
+	tb->step_ended = 0;
+	if (tb->running)
+		continue_run(tb);
+	else
+	{
+		tb->running = 1;
+		tb->trace_start = tb->trace_count; // dump this run's trace only
+		i_run_command_handler(tb);
+	}
+	tb->step_left = 0;
+	c_flush(tb);
+
+	if (tb->step_ended && !tb->err)
+		return TB_RUNNING;
+	tb->running = 0;
+	if (tb->err)
+	{
+		error(tb); // Print error message
+		return TB_ERROR;
+	}
+	return TB_OK;
+}
+
+TB_API unsigned long tb_statement_count(tb_context *tb)
+{
+	return tb->statement_count;
+}
+
+TB_API size_t tb_write_stats(tb_context *tb, char *text, size_t size)
+{
+	char buffer[(MAX_BYTE_VALUE + 1) * 32 + 512]; // every i-code and the rest
+	unsigned int i, len;
+	const char *separator = "";
+
+	len = sprintf(buffer, "{\"statements\": %lu, \"dispatch\": {", tb->statement_count);
+	for (i = 0; i <= MAX_BYTE_VALUE; i++)
+		if (tb->dispatch_count[i])
+		{
+			len += sprintf(buffer + len, "%s\"%s\": %lu", separator, get_icode_name(i), tb->dispatch_count[i]);
+			separator = ", ";
+		}
+	len += sprintf(buffer + len,
+				   "}, \"line_searches\": %lu, \"line_probes\": %lu, \"expressions\": %lu, "
+				   "\"gosub_depth_high\": %u, \"for_depth_high\": %u, \"list_bytes_high\": %u}",
+				   tb->line_search_count, tb->line_probe_count, tb->expression_count,
+				   tb->gosub_stack_high / 2, tb->for_stack_high, tb->list_length_high);
+	if (size)
+	{
+		memcpy(text, buffer, len < size ? len : size - 1);
+		text[len < size ? len : size - 1] = 0;
+	}
+	return len;
+}
+
+TB_API short tb_get_var(tb_context *tb, char name)
+{
+	if (!c_isalpha(name))
+		return 0;
+	return tb->variable_area[c_toupper(name) - 'A'];
+}
+
+TB_API int tb_set_var(tb_context *tb, char name, short value)
+{
+	if (!c_isalpha(name))
+		return TB_ERROR;
+	tb->variable_area[c_toupper(name) - 'A'] = value;
+	return TB_OK;
+}
+
+TB_API void tb_watch_escape(void)
+{
+	c_init_key_watcher();
+}
+
+/*
+TOYOSHIKI Tiny BASIC
+The BASIC entry point
+*/
+TB_API void tb_repl(tb_context *tb)
+{
+	unsigned short len;
+
+	tb->running = 0;
+	tb->batch_mode = 0;
+	c_puts(tb, "TOYOSHIKI TINY BASIC");
+	newline(tb);
+	c_puts(tb, STR_EDITION);
+	c_puts(tb, " EDITION");
+	newline(tb);
+	error(tb); // Print OK, and Clear error flag
+
+	// Input 1 line and execute
+	while (1)
+	{
+		c_putch(tb, '>'); // Prompt
+		if (!c_gets(tb))
+			break;						 // End of input
+		tb->trace_start = tb->trace_count; // dump this command's trace only
+		len = convert_token_to_icode(tb); // Convert token to i-code
+		if (tb->err)
+		{ // Error
+			error(tb);
+			continue; // Do nothing
+		}
+
+		// Quit if i-code is "SYSTEM"
+		if (*tb->icode_conversion_buffer == I_SYSTEM)
+		{
+			break;
+		}
+
+		// If the line starts with a number, store i-code in list
+		if (*tb->icode_conversion_buffer == I_NUM)
+		{													 // Case the top includes line number
+			insert_icode_to_the_list_preconditions(tb, len); // Insert list
+			if (tb->err)									 // Error
+				error(tb);									 // Print error message
+			continue;
+		}
+
+		// Simply execude the code in the the entered statement
+		i_command_processor(tb); // Execute direct
+		error(tb);				 // Print OK, and Clear error flag
+	}
+	tb->batch_mode = 1;
+	c_flush(tb);
+}
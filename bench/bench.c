@@ -0,0 +1,207 @@
+/*
+	TOYOSHIKI Tiny BASIC for Linux
+	Benchmark harness
+	Usage: bench [--engine=icode|bytecode] file.bas ...
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../ttbasic.h"
+
+#define BENCH_RUNS_MIN 5	  // Runs of 1 program at least
+#define BENCH_RUNS_MAX 101	  // Runs of 1 program at most
+#define BENCH_SECONDS 1.0	  // Least time to run 1 program for
+
+// Result of 1 benchmark, sent from the child
+struct bench_result
+{
+	int status;				 // 0, or 1 if the program stopped by an error
+	unsigned long statements; // statements run
+	unsigned long output;	 // output bytes
+	double seconds;			 // median wall time of load and run
+	int runs;				 // runs the median is taken from
+};
+
+// Output is counted and discarded
+void bench_output(void *user, const char *data, size_t len)
+{
+	(void)data;
+	*(unsigned long *)user += len;
+}
+
+// Benchmarks have no input
+size_t bench_input(void *user, char *data, size_t size)
+{
+	(void)user;
+	(void)data;
+	(void)size;
+	return 0;
+}
+
+double now(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+char *read_file(const char *file_name, size_t *len)
+{
+	FILE *file;
+	char *text;
+	long size;
+
+	file = fopen(file_name, "rb");
+	if (!file)
+		return NULL;
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	if (size < 0)
+	{
+		fclose(file);
+		return NULL;
+	}
+	text = malloc(size + 1);
+	if (text && fread(text, 1, size, file) != (size_t)size)
+	{
+		free(text);
+		text = NULL;
+	}
+	fclose(file);
+	*len = size;
+	return text;
+}
+
+int compare_seconds(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x > y) - (x < y);
+}
+
+// Load and run text once in a new interpreter
+// Return 0, 1 if the program stopped by an error, or 2 if there is no memory
+int bench_run_once(const char *text, size_t len, unsigned char engine, struct bench_result *result, double *seconds)
+{
+	struct tb_options options;
+	tb_context *tb;
+	double start;
+	int status;
+
+	memset(&options, 0, sizeof(options));
+	options.engine = engine;
+	options.flush_policy = TB_FLUSH_BLOCK;
+	options.array_size = TB_ARRAY_MAX;
+	options.output = bench_output;
+	options.output_user = &result->output;
+	options.input = bench_input;
+	tb = tb_create(&options);
+	if (!tb)
+		return 2;
+
+	result->output = 0;
+	start = now();
+	status = tb_load_source(tb, text, len) == TB_ERROR;
+	*seconds = now() - start;
+	result->statements = tb_statement_count(tb);
+	tb_destroy(tb);
+	return status;
+}
+
+// Run 1 benchmark in this process
+// The program runs BENCH_RUNS_MIN times, and again until BENCH_SECONDS
+// have passed, each time in a new interpreter. The median time is taken.
+void bench_run(const char *file_name, unsigned char engine, struct bench_result *result)
+{
+	double seconds[BENCH_RUNS_MAX];
+	double total = 0;
+	char *text;
+	size_t len;
+
+	memset(result, 0, sizeof(*result));
+	result->status = 2;
+	text = read_file(file_name, &len);
+	if (!text)
+		return;
+
+	while (result->runs < BENCH_RUNS_MIN || (total < BENCH_SECONDS && result->runs < BENCH_RUNS_MAX))
+	{
+		result->status = bench_run_once(text, len, engine, result, &seconds[result->runs]);
+		if (result->status)
+			break;
+		total += seconds[result->runs++];
+	}
+	free(text);
+	if (result->status)
+		return;
+
+	qsort(seconds, result->runs, sizeof(*seconds), compare_seconds);
+	result->seconds = seconds[result->runs / 2];
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned char engine = TB_ENGINE_ICODE;
+	struct bench_result result;
+	struct rusage usage;
+	const char *name;
+	int channel[2];
+	int i, status = 0;
+	pid_t child;
+
+	printf("%-20s %12s %10s %14s %6s %10s\n", "program", "statements", "wall s", "statements/s", "runs", "peak KiB");
+	for (i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--engine=icode") == 0)
+		{
+			engine = TB_ENGINE_ICODE;
+			continue;
+		}
+		if (strcmp(argv[i], "--engine=bytecode") == 0)
+		{
+			engine = TB_ENGINE_BYTECODE;
+			continue;
+		}
+
+		// Each program runs in its own process for its own peak RSS
+		fflush(stdout);
+		if (pipe(channel) < 0)
+			return 2;
+		child = fork();
+		if (child < 0)
+			return 2;
+		if (child == 0)
+		{
+			close(channel[0]);
+			bench_run(argv[i], engine, &result);
+			if (write(channel[1], &result, sizeof(result)) != sizeof(result))
+				_exit(2);
+			_exit(0);
+		}
+		close(channel[1]);
+		if (read(channel[0], &result, sizeof(result)) != sizeof(result))
+			result.status = 2;
+		close(channel[0]);
+		wait4(child, NULL, 0, &usage);
+
+		name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+		if (result.status)
+		{
+			printf("%-20s %s\n", name, result.status == 1 ? "stopped by an error" : "can't run");
+			status = 1;
+			continue;
+		}
+		printf("%-20s %12lu %10.3f %14.0f %6d %10ld\n", name, result.statements, result.seconds,
+			   result.seconds > 0 ? result.statements / result.seconds : 0, result.runs, usage.ru_maxrss);
+	}
+	return status;
+}
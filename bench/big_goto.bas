@@ -0,0 +1,2007 @@
+1 REM Large program: GOTO across 2000 lines in a scattered order, 10 rounds
+2 R=0
+3 R=R+1; IF R>10 GOTO 30000
+4 C=0; GOTO 10
+10 IF C<30000 C=C+1; GOTO 40
+20 IF C<30000 C=C+1; GOTO 110
+30 IF C<30000 C=C+1; GOTO 180
+40 IF C<30000 C=C+1; GOTO 250
+50 IF C<30000 C=C+1; GOTO 320
+60 IF C<30000 C=C+1; GOTO 390
+70 IF C<30000 C=C+1; GOTO 460
+80 IF C<30000 C=C+1; GOTO 530
+90 IF C<30000 C=C+1; GOTO 600
+100 IF C<30000 C=C+1; GOTO 670
+110 IF C<30000 C=C+1; GOTO 740
+120 IF C<30000 C=C+1; GOTO 810
+130 IF C<30000 C=C+1; GOTO 880
+140 IF C<30000 C=C+1; GOTO 950
+150 IF C<30000 C=C+1; GOTO 1020
+160 IF C<30000 C=C+1; GOTO 1090
+170 IF C<30000 C=C+1; GOTO 1160
+180 IF C<30000 C=C+1; GOTO 1230
+190 IF C<30000 C=C+1; GOTO 1300
+200 IF C<30000 C=C+1; GOTO 1370
+210 IF C<30000 C=C+1; GOTO 1440
+220 IF C<30000 C=C+1; GOTO 1510
+230 IF C<30000 C=C+1; GOTO 1580
+240 IF C<30000 C=C+1; GOTO 1650
+250 IF C<30000 C=C+1; GOTO 1720
+260 IF C<30000 C=C+1; GOTO 1790
+270 IF C<30000 C=C+1; GOTO 1860
+280 IF C<30000 C=C+1; GOTO 1930
+290 IF C<30000 C=C+1; GOTO 2000
+300 IF C<30000 C=C+1; GOTO 2070
+310 IF C<30000 C=C+1; GOTO 2140
+320 IF C<30000 C=C+1; GOTO 2210
+330 IF C<30000 C=C+1; GOTO 2280
+340 IF C<30000 C=C+1; GOTO 2350
+350 IF C<30000 C=C+1; GOTO 2420
+360 IF C<30000 C=C+1; GOTO 2490
+370 IF C<30000 C=C+1; GOTO 2560
+380 IF C<30000 C=C+1; GOTO 2630
+390 IF C<30000 C=C+1; GOTO 2700
+400 IF C<30000 C=C+1; GOTO 2770
+410 IF C<30000 C=C+1; GOTO 2840
+420 IF C<30000 C=C+1; GOTO 2910
+430 IF C<30000 C=C+1; GOTO 2980
+440 IF C<30000 C=C+1; GOTO 3050
+450 IF C<30000 C=C+1; GOTO 3120
+460 IF C<30000 C=C+1; GOTO 3190
+470 IF C<30000 C=C+1; GOTO 3260
+480 IF C<30000 C=C+1; GOTO 3330
+490 IF C<30000 C=C+1; GOTO 3400
+500 IF C<30000 C=C+1; GOTO 3470
+510 IF C<30000 C=C+1; GOTO 3540
+520 IF C<30000 C=C+1; GOTO 3610
+530 IF C<30000 C=C+1; GOTO 3680
+540 IF C<30000 C=C+1; GOTO 3750
+550 IF C<30000 C=C+1; GOTO 3820
+560 IF C<30000 C=C+1; GOTO 3890
+570 IF C<30000 C=C+1; GOTO 3960
+580 IF C<30000 C=C+1; GOTO 4030
+590 IF C<30000 C=C+1; GOTO 4100
+600 IF C<30000 C=C+1; GOTO 4170
+610 IF C<30000 C=C+1; GOTO 4240
+620 IF C<30000 C=C+1; GOTO 4310
+630 IF C<30000 C=C+1; GOTO 4380
+640 IF C<30000 C=C+1; GOTO 4450
+650 IF C<30000 C=C+1; GOTO 4520
+660 IF C<30000 C=C+1; GOTO 4590
+670 IF C<30000 C=C+1; GOTO 4660
+680 IF C<30000 C=C+1; GOTO 4730
+690 IF C<30000 C=C+1; GOTO 4800
+700 IF C<30000 C=C+1; GOTO 4870
+710 IF C<30000 C=C+1; GOTO 4940
+720 IF C<30000 C=C+1; GOTO 5010
+730 IF C<30000 C=C+1; GOTO 5080
+740 IF C<30000 C=C+1; GOTO 5150
+750 IF C<30000 C=C+1; GOTO 5220
+760 IF C<30000 C=C+1; GOTO 5290
+770 IF C<30000 C=C+1; GOTO 5360
+780 IF C<30000 C=C+1; GOTO 5430
+790 IF C<30000 C=C+1; GOTO 5500
+800 IF C<30000 C=C+1; GOTO 5570
+810 IF C<30000 C=C+1; GOTO 5640
+820 IF C<30000 C=C+1; GOTO 5710
+830 IF C<30000 C=C+1; GOTO 5780
+840 IF C<30000 C=C+1; GOTO 5850
+850 IF C<30000 C=C+1; GOTO 5920
+860 IF C<30000 C=C+1; GOTO 5990
+870 IF C<30000 C=C+1; GOTO 6060
+880 IF C<30000 C=C+1; GOTO 6130
+890 IF C<30000 C=C+1; GOTO 6200
+900 IF C<30000 C=C+1; GOTO 6270
+910 IF C<30000 C=C+1; GOTO 6340
+920 IF C<30000 C=C+1; GOTO 6410
+930 IF C<30000 C=C+1; GOTO 6480
+940 IF C<30000 C=C+1; GOTO 6550
+950 IF C<30000 C=C+1; GOTO 6620
+960 IF C<30000 C=C+1; GOTO 6690
+970 IF C<30000 C=C+1; GOTO 6760
+980 IF C<30000 C=C+1; GOTO 6830
+990 IF C<30000 C=C+1; GOTO 6900
+1000 IF C<30000 C=C+1; GOTO 6970
+1010 IF C<30000 C=C+1; GOTO 7040
+1020 IF C<30000 C=C+1; GOTO 7110
+1030 IF C<30000 C=C+1; GOTO 7180
+1040 IF C<30000 C=C+1; GOTO 7250
+1050 IF C<30000 C=C+1; GOTO 7320
+1060 IF C<30000 C=C+1; GOTO 7390
+1070 IF C<30000 C=C+1; GOTO 7460
+1080 IF C<30000 C=C+1; GOTO 7530
+1090 IF C<30000 C=C+1; GOTO 7600
+1100 IF C<30000 C=C+1; GOTO 7670
+1110 IF C<30000 C=C+1; GOTO 7740
+1120 IF C<30000 C=C+1; GOTO 7810
+1130 IF C<30000 C=C+1; GOTO 7880
+1140 IF C<30000 C=C+1; GOTO 7950
+1150 IF C<30000 C=C+1; GOTO 8020
+1160 IF C<30000 C=C+1; GOTO 8090
+1170 IF C<30000 C=C+1; GOTO 8160
+1180 IF C<30000 C=C+1; GOTO 8230
+1190 IF C<30000 C=C+1; GOTO 8300
+1200 IF C<30000 C=C+1; GOTO 8370
+1210 IF C<30000 C=C+1; GOTO 8440
+1220 IF C<30000 C=C+1; GOTO 8510
+1230 IF C<30000 C=C+1; GOTO 8580
+1240 IF C<30000 C=C+1; GOTO 8650
+1250 IF C<30000 C=C+1; GOTO 8720
+1260 IF C<30000 C=C+1; GOTO 8790
+1270 IF C<30000 C=C+1; GOTO 8860
+1280 IF C<30000 C=C+1; GOTO 8930
+1290 IF C<30000 C=C+1; GOTO 9000
+1300 IF C<30000 C=C+1; GOTO 9070
+1310 IF C<30000 C=C+1; GOTO 9140
+1320 IF C<30000 C=C+1; GOTO 9210
+1330 IF C<30000 C=C+1; GOTO 9280
+1340 IF C<30000 C=C+1; GOTO 9350
+1350 IF C<30000 C=C+1; GOTO 9420
+1360 IF C<30000 C=C+1; GOTO 9490
+1370 IF C<30000 C=C+1; GOTO 9560
+1380 IF C<30000 C=C+1; GOTO 9630
+1390 IF C<30000 C=C+1; GOTO 9700
+1400 IF C<30000 C=C+1; GOTO 9770
+1410 IF C<30000 C=C+1; GOTO 9840
+1420 IF C<30000 C=C+1; GOTO 9910
+1430 IF C<30000 C=C+1; GOTO 9980
+1440 IF C<30000 C=C+1; GOTO 10050
+1450 IF C<30000 C=C+1; GOTO 10120
+1460 IF C<30000 C=C+1; GOTO 10190
+1470 IF C<30000 C=C+1; GOTO 10260
+1480 IF C<30000 C=C+1; GOTO 10330
+1490 IF C<30000 C=C+1; GOTO 10400
+1500 IF C<30000 C=C+1; GOTO 10470
+1510 IF C<30000 C=C+1; GOTO 10540
+1520 IF C<30000 C=C+1; GOTO 10610
+1530 IF C<30000 C=C+1; GOTO 10680
+1540 IF C<30000 C=C+1; GOTO 10750
+1550 IF C<30000 C=C+1; GOTO 10820
+1560 IF C<30000 C=C+1; GOTO 10890
+1570 IF C<30000 C=C+1; GOTO 10960
+1580 IF C<30000 C=C+1; GOTO 11030
+1590 IF C<30000 C=C+1; GOTO 11100
+1600 IF C<30000 C=C+1; GOTO 11170
+1610 IF C<30000 C=C+1; GOTO 11240
+1620 IF C<30000 C=C+1; GOTO 11310
+1630 IF C<30000 C=C+1; GOTO 11380
+1640 IF C<30000 C=C+1; GOTO 11450
+1650 IF C<30000 C=C+1; GOTO 11520
+1660 IF C<30000 C=C+1; GOTO 11590
+1670 IF C<30000 C=C+1; GOTO 11660
+1680 IF C<30000 C=C+1; GOTO 11730
+1690 IF C<30000 C=C+1; GOTO 11800
+1700 IF C<30000 C=C+1; GOTO 11870
+1710 IF C<30000 C=C+1; GOTO 11940
+1720 IF C<30000 C=C+1; GOTO 12010
+1730 IF C<30000 C=C+1; GOTO 12080
+1740 IF C<30000 C=C+1; GOTO 12150
+1750 IF C<30000 C=C+1; GOTO 12220
+1760 IF C<30000 C=C+1; GOTO 12290
+1770 IF C<30000 C=C+1; GOTO 12360
+1780 IF C<30000 C=C+1; GOTO 12430
+1790 IF C<30000 C=C+1; GOTO 12500
+1800 IF C<30000 C=C+1; GOTO 12570
+1810 IF C<30000 C=C+1; GOTO 12640
+1820 IF C<30000 C=C+1; GOTO 12710
+1830 IF C<30000 C=C+1; GOTO 12780
+1840 IF C<30000 C=C+1; GOTO 12850
+1850 IF C<30000 C=C+1; GOTO 12920
+1860 IF C<30000 C=C+1; GOTO 12990
+1870 IF C<30000 C=C+1; GOTO 13060
+1880 IF C<30000 C=C+1; GOTO 13130
+1890 IF C<30000 C=C+1; GOTO 13200
+1900 IF C<30000 C=C+1; GOTO 13270
+1910 IF C<30000 C=C+1; GOTO 13340
+1920 IF C<30000 C=C+1; GOTO 13410
+1930 IF C<30000 C=C+1; GOTO 13480
+1940 IF C<30000 C=C+1; GOTO 13550
+1950 IF C<30000 C=C+1; GOTO 13620
+1960 IF C<30000 C=C+1; GOTO 13690
+1970 IF C<30000 C=C+1; GOTO 13760
+1980 IF C<30000 C=C+1; GOTO 13830
+1990 IF C<30000 C=C+1; GOTO 13900
+2000 IF C<30000 C=C+1; GOTO 13970
+2010 IF C<30000 C=C+1; GOTO 14040
+2020 IF C<30000 C=C+1; GOTO 14110
+2030 IF C<30000 C=C+1; GOTO 14180
+2040 IF C<30000 C=C+1; GOTO 14250
+2050 IF C<30000 C=C+1; GOTO 14320
+2060 IF C<30000 C=C+1; GOTO 14390
+2070 IF C<30000 C=C+1; GOTO 14460
+2080 IF C<30000 C=C+1; GOTO 14530
+2090 IF C<30000 C=C+1; GOTO 14600
+2100 IF C<30000 C=C+1; GOTO 14670
+2110 IF C<30000 C=C+1; GOTO 14740
+2120 IF C<30000 C=C+1; GOTO 14810
+2130 IF C<30000 C=C+1; GOTO 14880
+2140 IF C<30000 C=C+1; GOTO 14950
+2150 IF C<30000 C=C+1; GOTO 15020
+2160 IF C<30000 C=C+1; GOTO 15090
+2170 IF C<30000 C=C+1; GOTO 15160
+2180 IF C<30000 C=C+1; GOTO 15230
+2190 IF C<30000 C=C+1; GOTO 15300
+2200 IF C<30000 C=C+1; GOTO 15370
+2210 IF C<30000 C=C+1; GOTO 15440
+2220 IF C<30000 C=C+1; GOTO 15510
+2230 IF C<30000 C=C+1; GOTO 15580
+2240 IF C<30000 C=C+1; GOTO 15650
+2250 IF C<30000 C=C+1; GOTO 15720
+2260 IF C<30000 C=C+1; GOTO 15790
+2270 IF C<30000 C=C+1; GOTO 15860
+2280 IF C<30000 C=C+1; GOTO 15930
+2290 IF C<30000 C=C+1; GOTO 16000
+2300 IF C<30000 C=C+1; GOTO 16070
+2310 IF C<30000 C=C+1; GOTO 16140
+2320 IF C<30000 C=C+1; GOTO 16210
+2330 IF C<30000 C=C+1; GOTO 16280
+2340 IF C<30000 C=C+1; GOTO 16350
+2350 IF C<30000 C=C+1; GOTO 16420
+2360 IF C<30000 C=C+1; GOTO 16490
+2370 IF C<30000 C=C+1; GOTO 16560
+2380 IF C<30000 C=C+1; GOTO 16630
+2390 IF C<30000 C=C+1; GOTO 16700
+2400 IF C<30000 C=C+1; GOTO 16770
+2410 IF C<30000 C=C+1; GOTO 16840
+2420 IF C<30000 C=C+1; GOTO 16910
+2430 IF C<30000 C=C+1; GOTO 16980
+2440 IF C<30000 C=C+1; GOTO 17050
+2450 IF C<30000 C=C+1; GOTO 17120
+2460 IF C<30000 C=C+1; GOTO 17190
+2470 IF C<30000 C=C+1; GOTO 17260
+2480 IF C<30000 C=C+1; GOTO 17330
+2490 IF C<30000 C=C+1; GOTO 17400
+2500 IF C<30000 C=C+1; GOTO 17470
+2510 IF C<30000 C=C+1; GOTO 17540
+2520 IF C<30000 C=C+1; GOTO 17610
+2530 IF C<30000 C=C+1; GOTO 17680
+2540 IF C<30000 C=C+1; GOTO 17750
+2550 IF C<30000 C=C+1; GOTO 17820
+2560 IF C<30000 C=C+1; GOTO 17890
+2570 IF C<30000 C=C+1; GOTO 17960
+2580 IF C<30000 C=C+1; GOTO 18030
+2590 IF C<30000 C=C+1; GOTO 18100
+2600 IF C<30000 C=C+1; GOTO 18170
+2610 IF C<30000 C=C+1; GOTO 18240
+2620 IF C<30000 C=C+1; GOTO 18310
+2630 IF C<30000 C=C+1; GOTO 18380
+2640 IF C<30000 C=C+1; GOTO 18450
+2650 IF C<30000 C=C+1; GOTO 18520
+2660 IF C<30000 C=C+1; GOTO 18590
+2670 IF C<30000 C=C+1; GOTO 18660
+2680 IF C<30000 C=C+1; GOTO 18730
+2690 IF C<30000 C=C+1; GOTO 18800
+2700 IF C<30000 C=C+1; GOTO 18870
+2710 IF C<30000 C=C+1; GOTO 18940
+2720 IF C<30000 C=C+1; GOTO 19010
+2730 IF C<30000 C=C+1; GOTO 19080
+2740 IF C<30000 C=C+1; GOTO 19150
+2750 IF C<30000 C=C+1; GOTO 19220
+2760 IF C<30000 C=C+1; GOTO 19290
+2770 IF C<30000 C=C+1; GOTO 19360
+2780 IF C<30000 C=C+1; GOTO 19430
+2790 IF C<30000 C=C+1; GOTO 19500
+2800 IF C<30000 C=C+1; GOTO 19570
+2810 IF C<30000 C=C+1; GOTO 19640
+2820 IF C<30000 C=C+1; GOTO 19710
+2830 IF C<30000 C=C+1; GOTO 19780
+2840 IF C<30000 C=C+1; GOTO 19850
+2850 IF C<30000 C=C+1; GOTO 19920
+2860 IF C<30000 C=C+1; GOTO 19990
+2870 IF C<30000 C=C+1; GOTO 60
+2880 IF C<30000 C=C+1; GOTO 130
+2890 IF C<30000 C=C+1; GOTO 200
+2900 IF C<30000 C=C+1; GOTO 270
+2910 IF C<30000 C=C+1; GOTO 340
+2920 IF C<30000 C=C+1; GOTO 410
+2930 IF C<30000 C=C+1; GOTO 480
+2940 IF C<30000 C=C+1; GOTO 550
+2950 IF C<30000 C=C+1; GOTO 620
+2960 IF C<30000 C=C+1; GOTO 690
+2970 IF C<30000 C=C+1; GOTO 760
+2980 IF C<30000 C=C+1; GOTO 830
+2990 IF C<30000 C=C+1; GOTO 900
+3000 IF C<30000 C=C+1; GOTO 970
+3010 IF C<30000 C=C+1; GOTO 1040
+3020 IF C<30000 C=C+1; GOTO 1110
+3030 IF C<30000 C=C+1; GOTO 1180
+3040 IF C<30000 C=C+1; GOTO 1250
+3050 IF C<30000 C=C+1; GOTO 1320
+3060 IF C<30000 C=C+1; GOTO 1390
+3070 IF C<30000 C=C+1; GOTO 1460
+3080 IF C<30000 C=C+1; GOTO 1530
+3090 IF C<30000 C=C+1; GOTO 1600
+3100 IF C<30000 C=C+1; GOTO 1670
+3110 IF C<30000 C=C+1; GOTO 1740
+3120 IF C<30000 C=C+1; GOTO 1810
+3130 IF C<30000 C=C+1; GOTO 1880
+3140 IF C<30000 C=C+1; GOTO 1950
+3150 IF C<30000 C=C+1; GOTO 2020
+3160 IF C<30000 C=C+1; GOTO 2090
+3170 IF C<30000 C=C+1; GOTO 2160
+3180 IF C<30000 C=C+1; GOTO 2230
+3190 IF C<30000 C=C+1; GOTO 2300
+3200 IF C<30000 C=C+1; GOTO 2370
+3210 IF C<30000 C=C+1; GOTO 2440
+3220 IF C<30000 C=C+1; GOTO 2510
+3230 IF C<30000 C=C+1; GOTO 2580
+3240 IF C<30000 C=C+1; GOTO 2650
+3250 IF C<30000 C=C+1; GOTO 2720
+3260 IF C<30000 C=C+1; GOTO 2790
+3270 IF C<30000 C=C+1; GOTO 2860
+3280 IF C<30000 C=C+1; GOTO 2930
+3290 IF C<30000 C=C+1; GOTO 3000
+3300 IF C<30000 C=C+1; GOTO 3070
+3310 IF C<30000 C=C+1; GOTO 3140
+3320 IF C<30000 C=C+1; GOTO 3210
+3330 IF C<30000 C=C+1; GOTO 3280
+3340 IF C<30000 C=C+1; GOTO 3350
+3350 IF C<30000 C=C+1; GOTO 3420
+3360 IF C<30000 C=C+1; GOTO 3490
+3370 IF C<30000 C=C+1; GOTO 3560
+3380 IF C<30000 C=C+1; GOTO 3630
+3390 IF C<30000 C=C+1; GOTO 3700
+3400 IF C<30000 C=C+1; GOTO 3770
+3410 IF C<30000 C=C+1; GOTO 3840
+3420 IF C<30000 C=C+1; GOTO 3910
+3430 IF C<30000 C=C+1; GOTO 3980
+3440 IF C<30000 C=C+1; GOTO 4050
+3450 IF C<30000 C=C+1; GOTO 4120
+3460 IF C<30000 C=C+1; GOTO 4190
+3470 IF C<30000 C=C+1; GOTO 4260
+3480 IF C<30000 C=C+1; GOTO 4330
+3490 IF C<30000 C=C+1; GOTO 4400
+3500 IF C<30000 C=C+1; GOTO 4470
+3510 IF C<30000 C=C+1; GOTO 4540
+3520 IF C<30000 C=C+1; GOTO 4610
+3530 IF C<30000 C=C+1; GOTO 4680
+3540 IF C<30000 C=C+1; GOTO 4750
+3550 IF C<30000 C=C+1; GOTO 4820
+3560 IF C<30000 C=C+1; GOTO 4890
+3570 IF C<30000 C=C+1; GOTO 4960
+3580 IF C<30000 C=C+1; GOTO 5030
+3590 IF C<30000 C=C+1; GOTO 5100
+3600 IF C<30000 C=C+1; GOTO 5170
+3610 IF C<30000 C=C+1; GOTO 5240
+3620 IF C<30000 C=C+1; GOTO 5310
+3630 IF C<30000 C=C+1; GOTO 5380
+3640 IF C<30000 C=C+1; GOTO 5450
+3650 IF C<30000 C=C+1; GOTO 5520
+3660 IF C<30000 C=C+1; GOTO 5590
+3670 IF C<30000 C=C+1; GOTO 5660
+3680 IF C<30000 C=C+1; GOTO 5730
+3690 IF C<30000 C=C+1; GOTO 5800
+3700 IF C<30000 C=C+1; GOTO 5870
+3710 IF C<30000 C=C+1; GOTO 5940
+3720 IF C<30000 C=C+1; GOTO 6010
+3730 IF C<30000 C=C+1; GOTO 6080
+3740 IF C<30000 C=C+1; GOTO 6150
+3750 IF C<30000 C=C+1; GOTO 6220
+3760 IF C<30000 C=C+1; GOTO 6290
+3770 IF C<30000 C=C+1; GOTO 6360
+3780 IF C<30000 C=C+1; GOTO 6430
+3790 IF C<30000 C=C+1; GOTO 6500
+3800 IF C<30000 C=C+1; GOTO 6570
+3810 IF C<30000 C=C+1; GOTO 6640
+3820 IF C<30000 C=C+1; GOTO 6710
+3830 IF C<30000 C=C+1; GOTO 6780
+3840 IF C<30000 C=C+1; GOTO 6850
+3850 IF C<30000 C=C+1; GOTO 6920
+3860 IF C<30000 C=C+1; GOTO 6990
+3870 IF C<30000 C=C+1; GOTO 7060
+3880 IF C<30000 C=C+1; GOTO 7130
+3890 IF C<30000 C=C+1; GOTO 7200
+3900 IF C<30000 C=C+1; GOTO 7270
+3910 IF C<30000 C=C+1; GOTO 7340
+3920 IF C<30000 C=C+1; GOTO 7410
+3930 IF C<30000 C=C+1; GOTO 7480
+3940 IF C<30000 C=C+1; GOTO 7550
+3950 IF C<30000 C=C+1; GOTO 7620
+3960 IF C<30000 C=C+1; GOTO 7690
+3970 IF C<30000 C=C+1; GOTO 7760
+3980 IF C<30000 C=C+1; GOTO 7830
+3990 IF C<30000 C=C+1; GOTO 7900
+4000 IF C<30000 C=C+1; GOTO 7970
+4010 IF C<30000 C=C+1; GOTO 8040
+4020 IF C<30000 C=C+1; GOTO 8110
+4030 IF C<30000 C=C+1; GOTO 8180
+4040 IF C<30000 C=C+1; GOTO 8250
+4050 IF C<30000 C=C+1; GOTO 8320
+4060 IF C<30000 C=C+1; GOTO 8390
+4070 IF C<30000 C=C+1; GOTO 8460
+4080 IF C<30000 C=C+1; GOTO 8530
+4090 IF C<30000 C=C+1; GOTO 8600
+4100 IF C<30000 C=C+1; GOTO 8670
+4110 IF C<30000 C=C+1; GOTO 8740
+4120 IF C<30000 C=C+1; GOTO 8810
+4130 IF C<30000 C=C+1; GOTO 8880
+4140 IF C<30000 C=C+1; GOTO 8950
+4150 IF C<30000 C=C+1; GOTO 9020
+4160 IF C<30000 C=C+1; GOTO 9090
+4170 IF C<30000 C=C+1; GOTO 9160
+4180 IF C<30000 C=C+1; GOTO 9230
+4190 IF C<30000 C=C+1; GOTO 9300
+4200 IF C<30000 C=C+1; GOTO 9370
+4210 IF C<30000 C=C+1; GOTO 9440
+4220 IF C<30000 C=C+1; GOTO 9510
+4230 IF C<30000 C=C+1; GOTO 9580
+4240 IF C<30000 C=C+1; GOTO 9650
+4250 IF C<30000 C=C+1; GOTO 9720
+4260 IF C<30000 C=C+1; GOTO 9790
+4270 IF C<30000 C=C+1; GOTO 9860
+4280 IF C<30000 C=C+1; GOTO 9930
+4290 IF C<30000 C=C+1; GOTO 10000
+4300 IF C<30000 C=C+1; GOTO 10070
+4310 IF C<30000 C=C+1; GOTO 10140
+4320 IF C<30000 C=C+1; GOTO 10210
+4330 IF C<30000 C=C+1; GOTO 10280
+4340 IF C<30000 C=C+1; GOTO 10350
+4350 IF C<30000 C=C+1; GOTO 10420
+4360 IF C<30000 C=C+1; GOTO 10490
+4370 IF C<30000 C=C+1; GOTO 10560
+4380 IF C<30000 C=C+1; GOTO 10630
+4390 IF C<30000 C=C+1; GOTO 10700
+4400 IF C<30000 C=C+1; GOTO 10770
+4410 IF C<30000 C=C+1; GOTO 10840
+4420 IF C<30000 C=C+1; GOTO 10910
+4430 IF C<30000 C=C+1; GOTO 10980
+4440 IF C<30000 C=C+1; GOTO 11050
+4450 IF C<30000 C=C+1; GOTO 11120
+4460 IF C<30000 C=C+1; GOTO 11190
+4470 IF C<30000 C=C+1; GOTO 11260
+4480 IF C<30000 C=C+1; GOTO 11330
+4490 IF C<30000 C=C+1; GOTO 11400
+4500 IF C<30000 C=C+1; GOTO 11470
+4510 IF C<30000 C=C+1; GOTO 11540
+4520 IF C<30000 C=C+1; GOTO 11610
+4530 IF C<30000 C=C+1; GOTO 11680
+4540 IF C<30000 C=C+1; GOTO 11750
+4550 IF C<30000 C=C+1; GOTO 11820
+4560 IF C<30000 C=C+1; GOTO 11890
+4570 IF C<30000 C=C+1; GOTO 11960
+4580 IF C<30000 C=C+1; GOTO 12030
+4590 IF C<30000 C=C+1; GOTO 12100
+4600 IF C<30000 C=C+1; GOTO 12170
+4610 IF C<30000 C=C+1; GOTO 12240
+4620 IF C<30000 C=C+1; GOTO 12310
+4630 IF C<30000 C=C+1; GOTO 12380
+4640 IF C<30000 C=C+1; GOTO 12450
+4650 IF C<30000 C=C+1; GOTO 12520
+4660 IF C<30000 C=C+1; GOTO 12590
+4670 IF C<30000 C=C+1; GOTO 12660
+4680 IF C<30000 C=C+1; GOTO 12730
+4690 IF C<30000 C=C+1; GOTO 12800
+4700 IF C<30000 C=C+1; GOTO 12870
+4710 IF C<30000 C=C+1; GOTO 12940
+4720 IF C<30000 C=C+1; GOTO 13010
+4730 IF C<30000 C=C+1; GOTO 13080
+4740 IF C<30000 C=C+1; GOTO 13150
+4750 IF C<30000 C=C+1; GOTO 13220
+4760 IF C<30000 C=C+1; GOTO 13290
+4770 IF C<30000 C=C+1; GOTO 13360
+4780 IF C<30000 C=C+1; GOTO 13430
+4790 IF C<30000 C=C+1; GOTO 13500
+4800 IF C<30000 C=C+1; GOTO 13570
+4810 IF C<30000 C=C+1; GOTO 13640
+4820 IF C<30000 C=C+1; GOTO 13710
+4830 IF C<30000 C=C+1; GOTO 13780
+4840 IF C<30000 C=C+1; GOTO 13850
+4850 IF C<30000 C=C+1; GOTO 13920
+4860 IF C<30000 C=C+1; GOTO 13990
+4870 IF C<30000 C=C+1; GOTO 14060
+4880 IF C<30000 C=C+1; GOTO 14130
+4890 IF C<30000 C=C+1; GOTO 14200
+4900 IF C<30000 C=C+1; GOTO 14270
+4910 IF C<30000 C=C+1; GOTO 14340
+4920 IF C<30000 C=C+1; GOTO 14410
+4930 IF C<30000 C=C+1; GOTO 14480
+4940 IF C<30000 C=C+1; GOTO 14550
+4950 IF C<30000 C=C+1; GOTO 14620
+4960 IF C<30000 C=C+1; GOTO 14690
+4970 IF C<30000 C=C+1; GOTO 14760
+4980 IF C<30000 C=C+1; GOTO 14830
+4990 IF C<30000 C=C+1; GOTO 14900
+5000 IF C<30000 C=C+1; GOTO 14970
+5010 IF C<30000 C=C+1; GOTO 15040
+5020 IF C<30000 C=C+1; GOTO 15110
+5030 IF C<30000 C=C+1; GOTO 15180
+5040 IF C<30000 C=C+1; GOTO 15250
+5050 IF C<30000 C=C+1; GOTO 15320
+5060 IF C<30000 C=C+1; GOTO 15390
+5070 IF C<30000 C=C+1; GOTO 15460
+5080 IF C<30000 C=C+1; GOTO 15530
+5090 IF C<30000 C=C+1; GOTO 15600
+5100 IF C<30000 C=C+1; GOTO 15670
+5110 IF C<30000 C=C+1; GOTO 15740
+5120 IF C<30000 C=C+1; GOTO 15810
+5130 IF C<30000 C=C+1; GOTO 15880
+5140 IF C<30000 C=C+1; GOTO 15950
+5150 IF C<30000 C=C+1; GOTO 16020
+5160 IF C<30000 C=C+1; GOTO 16090
+5170 IF C<30000 C=C+1; GOTO 16160
+5180 IF C<30000 C=C+1; GOTO 16230
+5190 IF C<30000 C=C+1; GOTO 16300
+5200 IF C<30000 C=C+1; GOTO 16370
+5210 IF C<30000 C=C+1; GOTO 16440
+5220 IF C<30000 C=C+1; GOTO 16510
+5230 IF C<30000 C=C+1; GOTO 16580
+5240 IF C<30000 C=C+1; GOTO 16650
+5250 IF C<30000 C=C+1; GOTO 16720
+5260 IF C<30000 C=C+1; GOTO 16790
+5270 IF C<30000 C=C+1; GOTO 16860
+5280 IF C<30000 C=C+1; GOTO 16930
+5290 IF C<30000 C=C+1; GOTO 17000
+5300 IF C<30000 C=C+1; GOTO 17070
+5310 IF C<30000 C=C+1; GOTO 17140
+5320 IF C<30000 C=C+1; GOTO 17210
+5330 IF C<30000 C=C+1; GOTO 17280
+5340 IF C<30000 C=C+1; GOTO 17350
+5350 IF C<30000 C=C+1; GOTO 17420
+5360 IF C<30000 C=C+1; GOTO 17490
+5370 IF C<30000 C=C+1; GOTO 17560
+5380 IF C<30000 C=C+1; GOTO 17630
+5390 IF C<30000 C=C+1; GOTO 17700
+5400 IF C<30000 C=C+1; GOTO 17770
+5410 IF C<30000 C=C+1; GOTO 17840
+5420 IF C<30000 C=C+1; GOTO 17910
+5430 IF C<30000 C=C+1; GOTO 17980
+5440 IF C<30000 C=C+1; GOTO 18050
+5450 IF C<30000 C=C+1; GOTO 18120
+5460 IF C<30000 C=C+1; GOTO 18190
+5470 IF C<30000 C=C+1; GOTO 18260
+5480 IF C<30000 C=C+1; GOTO 18330
+5490 IF C<30000 C=C+1; GOTO 18400
+5500 IF C<30000 C=C+1; GOTO 18470
+5510 IF C<30000 C=C+1; GOTO 18540
+5520 IF C<30000 C=C+1; GOTO 18610
+5530 IF C<30000 C=C+1; GOTO 18680
+5540 IF C<30000 C=C+1; GOTO 18750
+5550 IF C<30000 C=C+1; GOTO 18820
+5560 IF C<30000 C=C+1; GOTO 18890
+5570 IF C<30000 C=C+1; GOTO 18960
+5580 IF C<30000 C=C+1; GOTO 19030
+5590 IF C<30000 C=C+1; GOTO 19100
+5600 IF C<30000 C=C+1; GOTO 19170
+5610 IF C<30000 C=C+1; GOTO 19240
+5620 IF C<30000 C=C+1; GOTO 19310
+5630 IF C<30000 C=C+1; GOTO 19380
+5640 IF C<30000 C=C+1; GOTO 19450
+5650 IF C<30000 C=C+1; GOTO 19520
+5660 IF C<30000 C=C+1; GOTO 19590
+5670 IF C<30000 C=C+1; GOTO 19660
+5680 IF C<30000 C=C+1; GOTO 19730
+5690 IF C<30000 C=C+1; GOTO 19800
+5700 IF C<30000 C=C+1; GOTO 19870
+5710 IF C<30000 C=C+1; GOTO 19940
+5720 IF C<30000 C=C+1; GOTO 10
+5730 IF C<30000 C=C+1; GOTO 80
+5740 IF C<30000 C=C+1; GOTO 150
+5750 IF C<30000 C=C+1; GOTO 220
+5760 IF C<30000 C=C+1; GOTO 290
+5770 IF C<30000 C=C+1; GOTO 360
+5780 IF C<30000 C=C+1; GOTO 430
+5790 IF C<30000 C=C+1; GOTO 500
+5800 IF C<30000 C=C+1; GOTO 570
+5810 IF C<30000 C=C+1; GOTO 640
+5820 IF C<30000 C=C+1; GOTO 710
+5830 IF C<30000 C=C+1; GOTO 780
+5840 IF C<30000 C=C+1; GOTO 850
+5850 IF C<30000 C=C+1; GOTO 920
+5860 IF C<30000 C=C+1; GOTO 990
+5870 IF C<30000 C=C+1; GOTO 1060
+5880 IF C<30000 C=C+1; GOTO 1130
+5890 IF C<30000 C=C+1; GOTO 1200
+5900 IF C<30000 C=C+1; GOTO 1270
+5910 IF C<30000 C=C+1; GOTO 1340
+5920 IF C<30000 C=C+1; GOTO 1410
+5930 IF C<30000 C=C+1; GOTO 1480
+5940 IF C<30000 C=C+1; GOTO 1550
+5950 IF C<30000 C=C+1; GOTO 1620
+5960 IF C<30000 C=C+1; GOTO 1690
+5970 IF C<30000 C=C+1; GOTO 1760
+5980 IF C<30000 C=C+1; GOTO 1830
+5990 IF C<30000 C=C+1; GOTO 1900
+6000 IF C<30000 C=C+1; GOTO 1970
+6010 IF C<30000 C=C+1; GOTO 2040
+6020 IF C<30000 C=C+1; GOTO 2110
+6030 IF C<30000 C=C+1; GOTO 2180
+6040 IF C<30000 C=C+1; GOTO 2250
+6050 IF C<30000 C=C+1; GOTO 2320
+6060 IF C<30000 C=C+1; GOTO 2390
+6070 IF C<30000 C=C+1; GOTO 2460
+6080 IF C<30000 C=C+1; GOTO 2530
+6090 IF C<30000 C=C+1; GOTO 2600
+6100 IF C<30000 C=C+1; GOTO 2670
+6110 IF C<30000 C=C+1; GOTO 2740
+6120 IF C<30000 C=C+1; GOTO 2810
+6130 IF C<30000 C=C+1; GOTO 2880
+6140 IF C<30000 C=C+1; GOTO 2950
+6150 IF C<30000 C=C+1; GOTO 3020
+6160 IF C<30000 C=C+1; GOTO 3090
+6170 IF C<30000 C=C+1; GOTO 3160
+6180 IF C<30000 C=C+1; GOTO 3230
+6190 IF C<30000 C=C+1; GOTO 3300
+6200 IF C<30000 C=C+1; GOTO 3370
+6210 IF C<30000 C=C+1; GOTO 3440
+6220 IF C<30000 C=C+1; GOTO 3510
+6230 IF C<30000 C=C+1; GOTO 3580
+6240 IF C<30000 C=C+1; GOTO 3650
+6250 IF C<30000 C=C+1; GOTO 3720
+6260 IF C<30000 C=C+1; GOTO 3790
+6270 IF C<30000 C=C+1; GOTO 3860
+6280 IF C<30000 C=C+1; GOTO 3930
+6290 IF C<30000 C=C+1; GOTO 4000
+6300 IF C<30000 C=C+1; GOTO 4070
+6310 IF C<30000 C=C+1; GOTO 4140
+6320 IF C<30000 C=C+1; GOTO 4210
+6330 IF C<30000 C=C+1; GOTO 4280
+6340 IF C<30000 C=C+1; GOTO 4350
+6350 IF C<30000 C=C+1; GOTO 4420
+6360 IF C<30000 C=C+1; GOTO 4490
+6370 IF C<30000 C=C+1; GOTO 4560
+6380 IF C<30000 C=C+1; GOTO 4630
+6390 IF C<30000 C=C+1; GOTO 4700
+6400 IF C<30000 C=C+1; GOTO 4770
+6410 IF C<30000 C=C+1; GOTO 4840
+6420 IF C<30000 C=C+1; GOTO 4910
+6430 IF C<30000 C=C+1; GOTO 4980
+6440 IF C<30000 C=C+1; GOTO 5050
+6450 IF C<30000 C=C+1; GOTO 5120
+6460 IF C<30000 C=C+1; GOTO 5190
+6470 IF C<30000 C=C+1; GOTO 5260
+6480 IF C<30000 C=C+1; GOTO 5330
+6490 IF C<30000 C=C+1; GOTO 5400
+6500 IF C<30000 C=C+1; GOTO 5470
+6510 IF C<30000 C=C+1; GOTO 5540
+6520 IF C<30000 C=C+1; GOTO 5610
+6530 IF C<30000 C=C+1; GOTO 5680
+6540 IF C<30000 C=C+1; GOTO 5750
+6550 IF C<30000 C=C+1; GOTO 5820
+6560 IF C<30000 C=C+1; GOTO 5890
+6570 IF C<30000 C=C+1; GOTO 5960
+6580 IF C<30000 C=C+1; GOTO 6030
+6590 IF C<30000 C=C+1; GOTO 6100
+6600 IF C<30000 C=C+1; GOTO 6170
+6610 IF C<30000 C=C+1; GOTO 6240
+6620 IF C<30000 C=C+1; GOTO 6310
+6630 IF C<30000 C=C+1; GOTO 6380
+6640 IF C<30000 C=C+1; GOTO 6450
+6650 IF C<30000 C=C+1; GOTO 6520
+6660 IF C<30000 C=C+1; GOTO 6590
+6670 IF C<30000 C=C+1; GOTO 6660
+6680 IF C<30000 C=C+1; GOTO 6730
+6690 IF C<30000 C=C+1; GOTO 6800
+6700 IF C<30000 C=C+1; GOTO 6870
+6710 IF C<30000 C=C+1; GOTO 6940
+6720 IF C<30000 C=C+1; GOTO 7010
+6730 IF C<30000 C=C+1; GOTO 7080
+6740 IF C<30000 C=C+1; GOTO 7150
+6750 IF C<30000 C=C+1; GOTO 7220
+6760 IF C<30000 C=C+1; GOTO 7290
+6770 IF C<30000 C=C+1; GOTO 7360
+6780 IF C<30000 C=C+1; GOTO 7430
+6790 IF C<30000 C=C+1; GOTO 7500
+6800 IF C<30000 C=C+1; GOTO 7570
+6810 IF C<30000 C=C+1; GOTO 7640
+6820 IF C<30000 C=C+1; GOTO 7710
+6830 IF C<30000 C=C+1; GOTO 7780
+6840 IF C<30000 C=C+1; GOTO 7850
+6850 IF C<30000 C=C+1; GOTO 7920
+6860 IF C<30000 C=C+1; GOTO 7990
+6870 IF C<30000 C=C+1; GOTO 8060
+6880 IF C<30000 C=C+1; GOTO 8130
+6890 IF C<30000 C=C+1; GOTO 8200
+6900 IF C<30000 C=C+1; GOTO 8270
+6910 IF C<30000 C=C+1; GOTO 8340
+6920 IF C<30000 C=C+1; GOTO 8410
+6930 IF C<30000 C=C+1; GOTO 8480
+6940 IF C<30000 C=C+1; GOTO 8550
+6950 IF C<30000 C=C+1; GOTO 8620
+6960 IF C<30000 C=C+1; GOTO 8690
+6970 IF C<30000 C=C+1; GOTO 8760
+6980 IF C<30000 C=C+1; GOTO 8830
+6990 IF C<30000 C=C+1; GOTO 8900
+7000 IF C<30000 C=C+1; GOTO 8970
+7010 IF C<30000 C=C+1; GOTO 9040
+7020 IF C<30000 C=C+1; GOTO 9110
+7030 IF C<30000 C=C+1; GOTO 9180
+7040 IF C<30000 C=C+1; GOTO 9250
+7050 IF C<30000 C=C+1; GOTO 9320
+7060 IF C<30000 C=C+1; GOTO 9390
+7070 IF C<30000 C=C+1; GOTO 9460
+7080 IF C<30000 C=C+1; GOTO 9530
+7090 IF C<30000 C=C+1; GOTO 9600
+7100 IF C<30000 C=C+1; GOTO 9670
+7110 IF C<30000 C=C+1; GOTO 9740
+7120 IF C<30000 C=C+1; GOTO 9810
+7130 IF C<30000 C=C+1; GOTO 9880
+7140 IF C<30000 C=C+1; GOTO 9950
+7150 IF C<30000 C=C+1; GOTO 10020
+7160 IF C<30000 C=C+1; GOTO 10090
+7170 IF C<30000 C=C+1; GOTO 10160
+7180 IF C<30000 C=C+1; GOTO 10230
+7190 IF C<30000 C=C+1; GOTO 10300
+7200 IF C<30000 C=C+1; GOTO 10370
+7210 IF C<30000 C=C+1; GOTO 10440
+7220 IF C<30000 C=C+1; GOTO 10510
+7230 IF C<30000 C=C+1; GOTO 10580
+7240 IF C<30000 C=C+1; GOTO 10650
+7250 IF C<30000 C=C+1; GOTO 10720
+7260 IF C<30000 C=C+1; GOTO 10790
+7270 IF C<30000 C=C+1; GOTO 10860
+7280 IF C<30000 C=C+1; GOTO 10930
+7290 IF C<30000 C=C+1; GOTO 11000
+7300 IF C<30000 C=C+1; GOTO 11070
+7310 IF C<30000 C=C+1; GOTO 11140
+7320 IF C<30000 C=C+1; GOTO 11210
+7330 IF C<30000 C=C+1; GOTO 11280
+7340 IF C<30000 C=C+1; GOTO 11350
+7350 IF C<30000 C=C+1; GOTO 11420
+7360 IF C<30000 C=C+1; GOTO 11490
+7370 IF C<30000 C=C+1; GOTO 11560
+7380 IF C<30000 C=C+1; GOTO 11630
+7390 IF C<30000 C=C+1; GOTO 11700
+7400 IF C<30000 C=C+1; GOTO 11770
+7410 IF C<30000 C=C+1; GOTO 11840
+7420 IF C<30000 C=C+1; GOTO 11910
+7430 IF C<30000 C=C+1; GOTO 11980
+7440 IF C<30000 C=C+1; GOTO 12050
+7450 IF C<30000 C=C+1; GOTO 12120
+7460 IF C<30000 C=C+1; GOTO 12190
+7470 IF C<30000 C=C+1; GOTO 12260
+7480 IF C<30000 C=C+1; GOTO 12330
+7490 IF C<30000 C=C+1; GOTO 12400
+7500 IF C<30000 C=C+1; GOTO 12470
+7510 IF C<30000 C=C+1; GOTO 12540
+7520 IF C<30000 C=C+1; GOTO 12610
+7530 IF C<30000 C=C+1; GOTO 12680
+7540 IF C<30000 C=C+1; GOTO 12750
+7550 IF C<30000 C=C+1; GOTO 12820
+7560 IF C<30000 C=C+1; GOTO 12890
+7570 IF C<30000 C=C+1; GOTO 12960
+7580 IF C<30000 C=C+1; GOTO 13030
+7590 IF C<30000 C=C+1; GOTO 13100
+7600 IF C<30000 C=C+1; GOTO 13170
+7610 IF C<30000 C=C+1; GOTO 13240
+7620 IF C<30000 C=C+1; GOTO 13310
+7630 IF C<30000 C=C+1; GOTO 13380
+7640 IF C<30000 C=C+1; GOTO 13450
+7650 IF C<30000 C=C+1; GOTO 13520
+7660 IF C<30000 C=C+1; GOTO 13590
+7670 IF C<30000 C=C+1; GOTO 13660
+7680 IF C<30000 C=C+1; GOTO 13730
+7690 IF C<30000 C=C+1; GOTO 13800
+7700 IF C<30000 C=C+1; GOTO 13870
+7710 IF C<30000 C=C+1; GOTO 13940
+7720 IF C<30000 C=C+1; GOTO 14010
+7730 IF C<30000 C=C+1; GOTO 14080
+7740 IF C<30000 C=C+1; GOTO 14150
+7750 IF C<30000 C=C+1; GOTO 14220
+7760 IF C<30000 C=C+1; GOTO 14290
+7770 IF C<30000 C=C+1; GOTO 14360
+7780 IF C<30000 C=C+1; GOTO 14430
+7790 IF C<30000 C=C+1; GOTO 14500
+7800 IF C<30000 C=C+1; GOTO 14570
+7810 IF C<30000 C=C+1; GOTO 14640
+7820 IF C<30000 C=C+1; GOTO 14710
+7830 IF C<30000 C=C+1; GOTO 14780
+7840 IF C<30000 C=C+1; GOTO 14850
+7850 IF C<30000 C=C+1; GOTO 14920
+7860 IF C<30000 C=C+1; GOTO 14990
+7870 IF C<30000 C=C+1; GOTO 15060
+7880 IF C<30000 C=C+1; GOTO 15130
+7890 IF C<30000 C=C+1; GOTO 15200
+7900 IF C<30000 C=C+1; GOTO 15270
+7910 IF C<30000 C=C+1; GOTO 15340
+7920 IF C<30000 C=C+1; GOTO 15410
+7930 IF C<30000 C=C+1; GOTO 15480
+7940 IF C<30000 C=C+1; GOTO 15550
+7950 IF C<30000 C=C+1; GOTO 15620
+7960 IF C<30000 C=C+1; GOTO 15690
+7970 IF C<30000 C=C+1; GOTO 15760
+7980 IF C<30000 C=C+1; GOTO 15830
+7990 IF C<30000 C=C+1; GOTO 15900
+8000 IF C<30000 C=C+1; GOTO 15970
+8010 IF C<30000 C=C+1; GOTO 16040
+8020 IF C<30000 C=C+1; GOTO 16110
+8030 IF C<30000 C=C+1; GOTO 16180
+8040 IF C<30000 C=C+1; GOTO 16250
+8050 IF C<30000 C=C+1; GOTO 16320
+8060 IF C<30000 C=C+1; GOTO 16390
+8070 IF C<30000 C=C+1; GOTO 16460
+8080 IF C<30000 C=C+1; GOTO 16530
+8090 IF C<30000 C=C+1; GOTO 16600
+8100 IF C<30000 C=C+1; GOTO 16670
+8110 IF C<30000 C=C+1; GOTO 16740
+8120 IF C<30000 C=C+1; GOTO 16810
+8130 IF C<30000 C=C+1; GOTO 16880
+8140 IF C<30000 C=C+1; GOTO 16950
+8150 IF C<30000 C=C+1; GOTO 17020
+8160 IF C<30000 C=C+1; GOTO 17090
+8170 IF C<30000 C=C+1; GOTO 17160
+8180 IF C<30000 C=C+1; GOTO 17230
+8190 IF C<30000 C=C+1; GOTO 17300
+8200 IF C<30000 C=C+1; GOTO 17370
+8210 IF C<30000 C=C+1; GOTO 17440
+8220 IF C<30000 C=C+1; GOTO 17510
+8230 IF C<30000 C=C+1; GOTO 17580
+8240 IF C<30000 C=C+1; GOTO 17650
+8250 IF C<30000 C=C+1; GOTO 17720
+8260 IF C<30000 C=C+1; GOTO 17790
+8270 IF C<30000 C=C+1; GOTO 17860
+8280 IF C<30000 C=C+1; GOTO 17930
+8290 IF C<30000 C=C+1; GOTO 18000
+8300 IF C<30000 C=C+1; GOTO 18070
+8310 IF C<30000 C=C+1; GOTO 18140
+8320 IF C<30000 C=C+1; GOTO 18210
+8330 IF C<30000 C=C+1; GOTO 18280
+8340 IF C<30000 C=C+1; GOTO 18350
+8350 IF C<30000 C=C+1; GOTO 18420
+8360 IF C<30000 C=C+1; GOTO 18490
+8370 IF C<30000 C=C+1; GOTO 18560
+8380 IF C<30000 C=C+1; GOTO 18630
+8390 IF C<30000 C=C+1; GOTO 18700
+8400 IF C<30000 C=C+1; GOTO 18770
+8410 IF C<30000 C=C+1; GOTO 18840
+8420 IF C<30000 C=C+1; GOTO 18910
+8430 IF C<30000 C=C+1; GOTO 18980
+8440 IF C<30000 C=C+1; GOTO 19050
+8450 IF C<30000 C=C+1; GOTO 19120
+8460 IF C<30000 C=C+1; GOTO 19190
+8470 IF C<30000 C=C+1; GOTO 19260
+8480 IF C<30000 C=C+1; GOTO 19330
+8490 IF C<30000 C=C+1; GOTO 19400
+8500 IF C<30000 C=C+1; GOTO 19470
+8510 IF C<30000 C=C+1; GOTO 19540
+8520 IF C<30000 C=C+1; GOTO 19610
+8530 IF C<30000 C=C+1; GOTO 19680
+8540 IF C<30000 C=C+1; GOTO 19750
+8550 IF C<30000 C=C+1; GOTO 19820
+8560 IF C<30000 C=C+1; GOTO 19890
+8570 IF C<30000 C=C+1; GOTO 19960
+8580 IF C<30000 C=C+1; GOTO 30
+8590 IF C<30000 C=C+1; GOTO 100
+8600 IF C<30000 C=C+1; GOTO 170
+8610 IF C<30000 C=C+1; GOTO 240
+8620 IF C<30000 C=C+1; GOTO 310
+8630 IF C<30000 C=C+1; GOTO 380
+8640 IF C<30000 C=C+1; GOTO 450
+8650 IF C<30000 C=C+1; GOTO 520
+8660 IF C<30000 C=C+1; GOTO 590
+8670 IF C<30000 C=C+1; GOTO 660
+8680 IF C<30000 C=C+1; GOTO 730
+8690 IF C<30000 C=C+1; GOTO 800
+8700 IF C<30000 C=C+1; GOTO 870
+8710 IF C<30000 C=C+1; GOTO 940
+8720 IF C<30000 C=C+1; GOTO 1010
+8730 IF C<30000 C=C+1; GOTO 1080
+8740 IF C<30000 C=C+1; GOTO 1150
+8750 IF C<30000 C=C+1; GOTO 1220
+8760 IF C<30000 C=C+1; GOTO 1290
+8770 IF C<30000 C=C+1; GOTO 1360
+8780 IF C<30000 C=C+1; GOTO 1430
+8790 IF C<30000 C=C+1; GOTO 1500
+8800 IF C<30000 C=C+1; GOTO 1570
+8810 IF C<30000 C=C+1; GOTO 1640
+8820 IF C<30000 C=C+1; GOTO 1710
+8830 IF C<30000 C=C+1; GOTO 1780
+8840 IF C<30000 C=C+1; GOTO 1850
+8850 IF C<30000 C=C+1; GOTO 1920
+8860 IF C<30000 C=C+1; GOTO 1990
+8870 IF C<30000 C=C+1; GOTO 2060
+8880 IF C<30000 C=C+1; GOTO 2130
+8890 IF C<30000 C=C+1; GOTO 2200
+8900 IF C<30000 C=C+1; GOTO 2270
+8910 IF C<30000 C=C+1; GOTO 2340
+8920 IF C<30000 C=C+1; GOTO 2410
+8930 IF C<30000 C=C+1; GOTO 2480
+8940 IF C<30000 C=C+1; GOTO 2550
+8950 IF C<30000 C=C+1; GOTO 2620
+8960 IF C<30000 C=C+1; GOTO 2690
+8970 IF C<30000 C=C+1; GOTO 2760
+8980 IF C<30000 C=C+1; GOTO 2830
+8990 IF C<30000 C=C+1; GOTO 2900
+9000 IF C<30000 C=C+1; GOTO 2970
+9010 IF C<30000 C=C+1; GOTO 3040
+9020 IF C<30000 C=C+1; GOTO 3110
+9030 IF C<30000 C=C+1; GOTO 3180
+9040 IF C<30000 C=C+1; GOTO 3250
+9050 IF C<30000 C=C+1; GOTO 3320
+9060 IF C<30000 C=C+1; GOTO 3390
+9070 IF C<30000 C=C+1; GOTO 3460
+9080 IF C<30000 C=C+1; GOTO 3530
+9090 IF C<30000 C=C+1; GOTO 3600
+9100 IF C<30000 C=C+1; GOTO 3670
+9110 IF C<30000 C=C+1; GOTO 3740
+9120 IF C<30000 C=C+1; GOTO 3810
+9130 IF C<30000 C=C+1; GOTO 3880
+9140 IF C<30000 C=C+1; GOTO 3950
+9150 IF C<30000 C=C+1; GOTO 4020
+9160 IF C<30000 C=C+1; GOTO 4090
+9170 IF C<30000 C=C+1; GOTO 4160
+9180 IF C<30000 C=C+1; GOTO 4230
+9190 IF C<30000 C=C+1; GOTO 4300
+9200 IF C<30000 C=C+1; GOTO 4370
+9210 IF C<30000 C=C+1; GOTO 4440
+9220 IF C<30000 C=C+1; GOTO 4510
+9230 IF C<30000 C=C+1; GOTO 4580
+9240 IF C<30000 C=C+1; GOTO 4650
+9250 IF C<30000 C=C+1; GOTO 4720
+9260 IF C<30000 C=C+1; GOTO 4790
+9270 IF C<30000 C=C+1; GOTO 4860
+9280 IF C<30000 C=C+1; GOTO 4930
+9290 IF C<30000 C=C+1; GOTO 5000
+9300 IF C<30000 C=C+1; GOTO 5070
+9310 IF C<30000 C=C+1; GOTO 5140
+9320 IF C<30000 C=C+1; GOTO 5210
+9330 IF C<30000 C=C+1; GOTO 5280
+9340 IF C<30000 C=C+1; GOTO 5350
+9350 IF C<30000 C=C+1; GOTO 5420
+9360 IF C<30000 C=C+1; GOTO 5490
+9370 IF C<30000 C=C+1; GOTO 5560
+9380 IF C<30000 C=C+1; GOTO 5630
+9390 IF C<30000 C=C+1; GOTO 5700
+9400 IF C<30000 C=C+1; GOTO 5770
+9410 IF C<30000 C=C+1; GOTO 5840
+9420 IF C<30000 C=C+1; GOTO 5910
+9430 IF C<30000 C=C+1; GOTO 5980
+9440 IF C<30000 C=C+1; GOTO 6050
+9450 IF C<30000 C=C+1; GOTO 6120
+9460 IF C<30000 C=C+1; GOTO 6190
+9470 IF C<30000 C=C+1; GOTO 6260
+9480 IF C<30000 C=C+1; GOTO 6330
+9490 IF C<30000 C=C+1; GOTO 6400
+9500 IF C<30000 C=C+1; GOTO 6470
+9510 IF C<30000 C=C+1; GOTO 6540
+9520 IF C<30000 C=C+1; GOTO 6610
+9530 IF C<30000 C=C+1; GOTO 6680
+9540 IF C<30000 C=C+1; GOTO 6750
+9550 IF C<30000 C=C+1; GOTO 6820
+9560 IF C<30000 C=C+1; GOTO 6890
+9570 IF C<30000 C=C+1; GOTO 6960
+9580 IF C<30000 C=C+1; GOTO 7030
+9590 IF C<30000 C=C+1; GOTO 7100
+9600 IF C<30000 C=C+1; GOTO 7170
+9610 IF C<30000 C=C+1; GOTO 7240
+9620 IF C<30000 C=C+1; GOTO 7310
+9630 IF C<30000 C=C+1; GOTO 7380
+9640 IF C<30000 C=C+1; GOTO 7450
+9650 IF C<30000 C=C+1; GOTO 7520
+9660 IF C<30000 C=C+1; GOTO 7590
+9670 IF C<30000 C=C+1; GOTO 7660
+9680 IF C<30000 C=C+1; GOTO 7730
+9690 IF C<30000 C=C+1; GOTO 7800
+9700 IF C<30000 C=C+1; GOTO 7870
+9710 IF C<30000 C=C+1; GOTO 7940
+9720 IF C<30000 C=C+1; GOTO 8010
+9730 IF C<30000 C=C+1; GOTO 8080
+9740 IF C<30000 C=C+1; GOTO 8150
+9750 IF C<30000 C=C+1; GOTO 8220
+9760 IF C<30000 C=C+1; GOTO 8290
+9770 IF C<30000 C=C+1; GOTO 8360
+9780 IF C<30000 C=C+1; GOTO 8430
+9790 IF C<30000 C=C+1; GOTO 8500
+9800 IF C<30000 C=C+1; GOTO 8570
+9810 IF C<30000 C=C+1; GOTO 8640
+9820 IF C<30000 C=C+1; GOTO 8710
+9830 IF C<30000 C=C+1; GOTO 8780
+9840 IF C<30000 C=C+1; GOTO 8850
+9850 IF C<30000 C=C+1; GOTO 8920
+9860 IF C<30000 C=C+1; GOTO 8990
+9870 IF C<30000 C=C+1; GOTO 9060
+9880 IF C<30000 C=C+1; GOTO 9130
+9890 IF C<30000 C=C+1; GOTO 9200
+9900 IF C<30000 C=C+1; GOTO 9270
+9910 IF C<30000 C=C+1; GOTO 9340
+9920 IF C<30000 C=C+1; GOTO 9410
+9930 IF C<30000 C=C+1; GOTO 9480
+9940 IF C<30000 C=C+1; GOTO 9550
+9950 IF C<30000 C=C+1; GOTO 9620
+9960 IF C<30000 C=C+1; GOTO 9690
+9970 IF C<30000 C=C+1; GOTO 9760
+9980 IF C<30000 C=C+1; GOTO 9830
+9990 IF C<30000 C=C+1; GOTO 9900
+10000 IF C<30000 C=C+1; GOTO 9970
+10010 IF C<30000 C=C+1; GOTO 10040
+10020 IF C<30000 C=C+1; GOTO 10110
+10030 IF C<30000 C=C+1; GOTO 10180
+10040 IF C<30000 C=C+1; GOTO 10250
+10050 IF C<30000 C=C+1; GOTO 10320
+10060 IF C<30000 C=C+1; GOTO 10390
+10070 IF C<30000 C=C+1; GOTO 10460
+10080 IF C<30000 C=C+1; GOTO 10530
+10090 IF C<30000 C=C+1; GOTO 10600
+10100 IF C<30000 C=C+1; GOTO 10670
+10110 IF C<30000 C=C+1; GOTO 10740
+10120 IF C<30000 C=C+1; GOTO 10810
+10130 IF C<30000 C=C+1; GOTO 10880
+10140 IF C<30000 C=C+1; GOTO 10950
+10150 IF C<30000 C=C+1; GOTO 11020
+10160 IF C<30000 C=C+1; GOTO 11090
+10170 IF C<30000 C=C+1; GOTO 11160
+10180 IF C<30000 C=C+1; GOTO 11230
+10190 IF C<30000 C=C+1; GOTO 11300
+10200 IF C<30000 C=C+1; GOTO 11370
+10210 IF C<30000 C=C+1; GOTO 11440
+10220 IF C<30000 C=C+1; GOTO 11510
+10230 IF C<30000 C=C+1; GOTO 11580
+10240 IF C<30000 C=C+1; GOTO 11650
+10250 IF C<30000 C=C+1; GOTO 11720
+10260 IF C<30000 C=C+1; GOTO 11790
+10270 IF C<30000 C=C+1; GOTO 11860
+10280 IF C<30000 C=C+1; GOTO 11930
+10290 IF C<30000 C=C+1; GOTO 12000
+10300 IF C<30000 C=C+1; GOTO 12070
+10310 IF C<30000 C=C+1; GOTO 12140
+10320 IF C<30000 C=C+1; GOTO 12210
+10330 IF C<30000 C=C+1; GOTO 12280
+10340 IF C<30000 C=C+1; GOTO 12350
+10350 IF C<30000 C=C+1; GOTO 12420
+10360 IF C<30000 C=C+1; GOTO 12490
+10370 IF C<30000 C=C+1; GOTO 12560
+10380 IF C<30000 C=C+1; GOTO 12630
+10390 IF C<30000 C=C+1; GOTO 12700
+10400 IF C<30000 C=C+1; GOTO 12770
+10410 IF C<30000 C=C+1; GOTO 12840
+10420 IF C<30000 C=C+1; GOTO 12910
+10430 IF C<30000 C=C+1; GOTO 12980
+10440 IF C<30000 C=C+1; GOTO 13050
+10450 IF C<30000 C=C+1; GOTO 13120
+10460 IF C<30000 C=C+1; GOTO 13190
+10470 IF C<30000 C=C+1; GOTO 13260
+10480 IF C<30000 C=C+1; GOTO 13330
+10490 IF C<30000 C=C+1; GOTO 13400
+10500 IF C<30000 C=C+1; GOTO 13470
+10510 IF C<30000 C=C+1; GOTO 13540
+10520 IF C<30000 C=C+1; GOTO 13610
+10530 IF C<30000 C=C+1; GOTO 13680
+10540 IF C<30000 C=C+1; GOTO 13750
+10550 IF C<30000 C=C+1; GOTO 13820
+10560 IF C<30000 C=C+1; GOTO 13890
+10570 IF C<30000 C=C+1; GOTO 13960
+10580 IF C<30000 C=C+1; GOTO 14030
+10590 IF C<30000 C=C+1; GOTO 14100
+10600 IF C<30000 C=C+1; GOTO 14170
+10610 IF C<30000 C=C+1; GOTO 14240
+10620 IF C<30000 C=C+1; GOTO 14310
+10630 IF C<30000 C=C+1; GOTO 14380
+10640 IF C<30000 C=C+1; GOTO 14450
+10650 IF C<30000 C=C+1; GOTO 14520
+10660 IF C<30000 C=C+1; GOTO 14590
+10670 IF C<30000 C=C+1; GOTO 14660
+10680 IF C<30000 C=C+1; GOTO 14730
+10690 IF C<30000 C=C+1; GOTO 14800
+10700 IF C<30000 C=C+1; GOTO 14870
+10710 IF C<30000 C=C+1; GOTO 14940
+10720 IF C<30000 C=C+1; GOTO 15010
+10730 IF C<30000 C=C+1; GOTO 15080
+10740 IF C<30000 C=C+1; GOTO 15150
+10750 IF C<30000 C=C+1; GOTO 15220
+10760 IF C<30000 C=C+1; GOTO 15290
+10770 IF C<30000 C=C+1; GOTO 15360
+10780 IF C<30000 C=C+1; GOTO 15430
+10790 IF C<30000 C=C+1; GOTO 15500
+10800 IF C<30000 C=C+1; GOTO 15570
+10810 IF C<30000 C=C+1; GOTO 15640
+10820 IF C<30000 C=C+1; GOTO 15710
+10830 IF C<30000 C=C+1; GOTO 15780
+10840 IF C<30000 C=C+1; GOTO 15850
+10850 IF C<30000 C=C+1; GOTO 15920
+10860 IF C<30000 C=C+1; GOTO 15990
+10870 IF C<30000 C=C+1; GOTO 16060
+10880 IF C<30000 C=C+1; GOTO 16130
+10890 IF C<30000 C=C+1; GOTO 16200
+10900 IF C<30000 C=C+1; GOTO 16270
+10910 IF C<30000 C=C+1; GOTO 16340
+10920 IF C<30000 C=C+1; GOTO 16410
+10930 IF C<30000 C=C+1; GOTO 16480
+10940 IF C<30000 C=C+1; GOTO 16550
+10950 IF C<30000 C=C+1; GOTO 16620
+10960 IF C<30000 C=C+1; GOTO 16690
+10970 IF C<30000 C=C+1; GOTO 16760
+10980 IF C<30000 C=C+1; GOTO 16830
+10990 IF C<30000 C=C+1; GOTO 16900
+11000 IF C<30000 C=C+1; GOTO 16970
+11010 IF C<30000 C=C+1; GOTO 17040
+11020 IF C<30000 C=C+1; GOTO 17110
+11030 IF C<30000 C=C+1; GOTO 17180
+11040 IF C<30000 C=C+1; GOTO 17250
+11050 IF C<30000 C=C+1; GOTO 17320
+11060 IF C<30000 C=C+1; GOTO 17390
+11070 IF C<30000 C=C+1; GOTO 17460
+11080 IF C<30000 C=C+1; GOTO 17530
+11090 IF C<30000 C=C+1; GOTO 17600
+11100 IF C<30000 C=C+1; GOTO 17670
+11110 IF C<30000 C=C+1; GOTO 17740
+11120 IF C<30000 C=C+1; GOTO 17810
+11130 IF C<30000 C=C+1; GOTO 17880
+11140 IF C<30000 C=C+1; GOTO 17950
+11150 IF C<30000 C=C+1; GOTO 18020
+11160 IF C<30000 C=C+1; GOTO 18090
+11170 IF C<30000 C=C+1; GOTO 18160
+11180 IF C<30000 C=C+1; GOTO 18230
+11190 IF C<30000 C=C+1; GOTO 18300
+11200 IF C<30000 C=C+1; GOTO 18370
+11210 IF C<30000 C=C+1; GOTO 18440
+11220 IF C<30000 C=C+1; GOTO 18510
+11230 IF C<30000 C=C+1; GOTO 18580
+11240 IF C<30000 C=C+1; GOTO 18650
+11250 IF C<30000 C=C+1; GOTO 18720
+11260 IF C<30000 C=C+1; GOTO 18790
+11270 IF C<30000 C=C+1; GOTO 18860
+11280 IF C<30000 C=C+1; GOTO 18930
+11290 IF C<30000 C=C+1; GOTO 19000
+11300 IF C<30000 C=C+1; GOTO 19070
+11310 IF C<30000 C=C+1; GOTO 19140
+11320 IF C<30000 C=C+1; GOTO 19210
+11330 IF C<30000 C=C+1; GOTO 19280
+11340 IF C<30000 C=C+1; GOTO 19350
+11350 IF C<30000 C=C+1; GOTO 19420
+11360 IF C<30000 C=C+1; GOTO 19490
+11370 IF C<30000 C=C+1; GOTO 19560
+11380 IF C<30000 C=C+1; GOTO 19630
+11390 IF C<30000 C=C+1; GOTO 19700
+11400 IF C<30000 C=C+1; GOTO 19770
+11410 IF C<30000 C=C+1; GOTO 19840
+11420 IF C<30000 C=C+1; GOTO 19910
+11430 IF C<30000 C=C+1; GOTO 19980
+11440 IF C<30000 C=C+1; GOTO 50
+11450 IF C<30000 C=C+1; GOTO 120
+11460 IF C<30000 C=C+1; GOTO 190
+11470 IF C<30000 C=C+1; GOTO 260
+11480 IF C<30000 C=C+1; GOTO 330
+11490 IF C<30000 C=C+1; GOTO 400
+11500 IF C<30000 C=C+1; GOTO 470
+11510 IF C<30000 C=C+1; GOTO 540
+11520 IF C<30000 C=C+1; GOTO 610
+11530 IF C<30000 C=C+1; GOTO 680
+11540 IF C<30000 C=C+1; GOTO 750
+11550 IF C<30000 C=C+1; GOTO 820
+11560 IF C<30000 C=C+1; GOTO 890
+11570 IF C<30000 C=C+1; GOTO 960
+11580 IF C<30000 C=C+1; GOTO 1030
+11590 IF C<30000 C=C+1; GOTO 1100
+11600 IF C<30000 C=C+1; GOTO 1170
+11610 IF C<30000 C=C+1; GOTO 1240
+11620 IF C<30000 C=C+1; GOTO 1310
+11630 IF C<30000 C=C+1; GOTO 1380
+11640 IF C<30000 C=C+1; GOTO 1450
+11650 IF C<30000 C=C+1; GOTO 1520
+11660 IF C<30000 C=C+1; GOTO 1590
+11670 IF C<30000 C=C+1; GOTO 1660
+11680 IF C<30000 C=C+1; GOTO 1730
+11690 IF C<30000 C=C+1; GOTO 1800
+11700 IF C<30000 C=C+1; GOTO 1870
+11710 IF C<30000 C=C+1; GOTO 1940
+11720 IF C<30000 C=C+1; GOTO 2010
+11730 IF C<30000 C=C+1; GOTO 2080
+11740 IF C<30000 C=C+1; GOTO 2150
+11750 IF C<30000 C=C+1; GOTO 2220
+11760 IF C<30000 C=C+1; GOTO 2290
+11770 IF C<30000 C=C+1; GOTO 2360
+11780 IF C<30000 C=C+1; GOTO 2430
+11790 IF C<30000 C=C+1; GOTO 2500
+11800 IF C<30000 C=C+1; GOTO 2570
+11810 IF C<30000 C=C+1; GOTO 2640
+11820 IF C<30000 C=C+1; GOTO 2710
+11830 IF C<30000 C=C+1; GOTO 2780
+11840 IF C<30000 C=C+1; GOTO 2850
+11850 IF C<30000 C=C+1; GOTO 2920
+11860 IF C<30000 C=C+1; GOTO 2990
+11870 IF C<30000 C=C+1; GOTO 3060
+11880 IF C<30000 C=C+1; GOTO 3130
+11890 IF C<30000 C=C+1; GOTO 3200
+11900 IF C<30000 C=C+1; GOTO 3270
+11910 IF C<30000 C=C+1; GOTO 3340
+11920 IF C<30000 C=C+1; GOTO 3410
+11930 IF C<30000 C=C+1; GOTO 3480
+11940 IF C<30000 C=C+1; GOTO 3550
+11950 IF C<30000 C=C+1; GOTO 3620
+11960 IF C<30000 C=C+1; GOTO 3690
+11970 IF C<30000 C=C+1; GOTO 3760
+11980 IF C<30000 C=C+1; GOTO 3830
+11990 IF C<30000 C=C+1; GOTO 3900
+12000 IF C<30000 C=C+1; GOTO 3970
+12010 IF C<30000 C=C+1; GOTO 4040
+12020 IF C<30000 C=C+1; GOTO 4110
+12030 IF C<30000 C=C+1; GOTO 4180
+12040 IF C<30000 C=C+1; GOTO 4250
+12050 IF C<30000 C=C+1; GOTO 4320
+12060 IF C<30000 C=C+1; GOTO 4390
+12070 IF C<30000 C=C+1; GOTO 4460
+12080 IF C<30000 C=C+1; GOTO 4530
+12090 IF C<30000 C=C+1; GOTO 4600
+12100 IF C<30000 C=C+1; GOTO 4670
+12110 IF C<30000 C=C+1; GOTO 4740
+12120 IF C<30000 C=C+1; GOTO 4810
+12130 IF C<30000 C=C+1; GOTO 4880
+12140 IF C<30000 C=C+1; GOTO 4950
+12150 IF C<30000 C=C+1; GOTO 5020
+12160 IF C<30000 C=C+1; GOTO 5090
+12170 IF C<30000 C=C+1; GOTO 5160
+12180 IF C<30000 C=C+1; GOTO 5230
+12190 IF C<30000 C=C+1; GOTO 5300
+12200 IF C<30000 C=C+1; GOTO 5370
+12210 IF C<30000 C=C+1; GOTO 5440
+12220 IF C<30000 C=C+1; GOTO 5510
+12230 IF C<30000 C=C+1; GOTO 5580
+12240 IF C<30000 C=C+1; GOTO 5650
+12250 IF C<30000 C=C+1; GOTO 5720
+12260 IF C<30000 C=C+1; GOTO 5790
+12270 IF C<30000 C=C+1; GOTO 5860
+12280 IF C<30000 C=C+1; GOTO 5930
+12290 IF C<30000 C=C+1; GOTO 6000
+12300 IF C<30000 C=C+1; GOTO 6070
+12310 IF C<30000 C=C+1; GOTO 6140
+12320 IF C<30000 C=C+1; GOTO 6210
+12330 IF C<30000 C=C+1; GOTO 6280
+12340 IF C<30000 C=C+1; GOTO 6350
+12350 IF C<30000 C=C+1; GOTO 6420
+12360 IF C<30000 C=C+1; GOTO 6490
+12370 IF C<30000 C=C+1; GOTO 6560
+12380 IF C<30000 C=C+1; GOTO 6630
+12390 IF C<30000 C=C+1; GOTO 6700
+12400 IF C<30000 C=C+1; GOTO 6770
+12410 IF C<30000 C=C+1; GOTO 6840
+12420 IF C<30000 C=C+1; GOTO 6910
+12430 IF C<30000 C=C+1; GOTO 6980
+12440 IF C<30000 C=C+1; GOTO 7050
+12450 IF C<30000 C=C+1; GOTO 7120
+12460 IF C<30000 C=C+1; GOTO 7190
+12470 IF C<30000 C=C+1; GOTO 7260
+12480 IF C<30000 C=C+1; GOTO 7330
+12490 IF C<30000 C=C+1; GOTO 7400
+12500 IF C<30000 C=C+1; GOTO 7470
+12510 IF C<30000 C=C+1; GOTO 7540
+12520 IF C<30000 C=C+1; GOTO 7610
+12530 IF C<30000 C=C+1; GOTO 7680
+12540 IF C<30000 C=C+1; GOTO 7750
+12550 IF C<30000 C=C+1; GOTO 7820
+12560 IF C<30000 C=C+1; GOTO 7890
+12570 IF C<30000 C=C+1; GOTO 7960
+12580 IF C<30000 C=C+1; GOTO 8030
+12590 IF C<30000 C=C+1; GOTO 8100
+12600 IF C<30000 C=C+1; GOTO 8170
+12610 IF C<30000 C=C+1; GOTO 8240
+12620 IF C<30000 C=C+1; GOTO 8310
+12630 IF C<30000 C=C+1; GOTO 8380
+12640 IF C<30000 C=C+1; GOTO 8450
+12650 IF C<30000 C=C+1; GOTO 8520
+12660 IF C<30000 C=C+1; GOTO 8590
+12670 IF C<30000 C=C+1; GOTO 8660
+12680 IF C<30000 C=C+1; GOTO 8730
+12690 IF C<30000 C=C+1; GOTO 8800
+12700 IF C<30000 C=C+1; GOTO 8870
+12710 IF C<30000 C=C+1; GOTO 8940
+12720 IF C<30000 C=C+1; GOTO 9010
+12730 IF C<30000 C=C+1; GOTO 9080
+12740 IF C<30000 C=C+1; GOTO 9150
+12750 IF C<30000 C=C+1; GOTO 9220
+12760 IF C<30000 C=C+1; GOTO 9290
+12770 IF C<30000 C=C+1; GOTO 9360
+12780 IF C<30000 C=C+1; GOTO 9430
+12790 IF C<30000 C=C+1; GOTO 9500
+12800 IF C<30000 C=C+1; GOTO 9570
+12810 IF C<30000 C=C+1; GOTO 9640
+12820 IF C<30000 C=C+1; GOTO 9710
+12830 IF C<30000 C=C+1; GOTO 9780
+12840 IF C<30000 C=C+1; GOTO 9850
+12850 IF C<30000 C=C+1; GOTO 9920
+12860 IF C<30000 C=C+1; GOTO 9990
+12870 IF C<30000 C=C+1; GOTO 10060
+12880 IF C<30000 C=C+1; GOTO 10130
+12890 IF C<30000 C=C+1; GOTO 10200
+12900 IF C<30000 C=C+1; GOTO 10270
+12910 IF C<30000 C=C+1; GOTO 10340
+12920 IF C<30000 C=C+1; GOTO 10410
+12930 IF C<30000 C=C+1; GOTO 10480
+12940 IF C<30000 C=C+1; GOTO 10550
+12950 IF C<30000 C=C+1; GOTO 10620
+12960 IF C<30000 C=C+1; GOTO 10690
+12970 IF C<30000 C=C+1; GOTO 10760
+12980 IF C<30000 C=C+1; GOTO 10830
+12990 IF C<30000 C=C+1; GOTO 10900
+13000 IF C<30000 C=C+1; GOTO 10970
+13010 IF C<30000 C=C+1; GOTO 11040
+13020 IF C<30000 C=C+1; GOTO 11110
+13030 IF C<30000 C=C+1; GOTO 11180
+13040 IF C<30000 C=C+1; GOTO 11250
+13050 IF C<30000 C=C+1; GOTO 11320
+13060 IF C<30000 C=C+1; GOTO 11390
+13070 IF C<30000 C=C+1; GOTO 11460
+13080 IF C<30000 C=C+1; GOTO 11530
+13090 IF C<30000 C=C+1; GOTO 11600
+13100 IF C<30000 C=C+1; GOTO 11670
+13110 IF C<30000 C=C+1; GOTO 11740
+13120 IF C<30000 C=C+1; GOTO 11810
+13130 IF C<30000 C=C+1; GOTO 11880
+13140 IF C<30000 C=C+1; GOTO 11950
+13150 IF C<30000 C=C+1; GOTO 12020
+13160 IF C<30000 C=C+1; GOTO 12090
+13170 IF C<30000 C=C+1; GOTO 12160
+13180 IF C<30000 C=C+1; GOTO 12230
+13190 IF C<30000 C=C+1; GOTO 12300
+13200 IF C<30000 C=C+1; GOTO 12370
+13210 IF C<30000 C=C+1; GOTO 12440
+13220 IF C<30000 C=C+1; GOTO 12510
+13230 IF C<30000 C=C+1; GOTO 12580
+13240 IF C<30000 C=C+1; GOTO 12650
+13250 IF C<30000 C=C+1; GOTO 12720
+13260 IF C<30000 C=C+1; GOTO 12790
+13270 IF C<30000 C=C+1; GOTO 12860
+13280 IF C<30000 C=C+1; GOTO 12930
+13290 IF C<30000 C=C+1; GOTO 13000
+13300 IF C<30000 C=C+1; GOTO 13070
+13310 IF C<30000 C=C+1; GOTO 13140
+13320 IF C<30000 C=C+1; GOTO 13210
+13330 IF C<30000 C=C+1; GOTO 13280
+13340 IF C<30000 C=C+1; GOTO 13350
+13350 IF C<30000 C=C+1; GOTO 13420
+13360 IF C<30000 C=C+1; GOTO 13490
+13370 IF C<30000 C=C+1; GOTO 13560
+13380 IF C<30000 C=C+1; GOTO 13630
+13390 IF C<30000 C=C+1; GOTO 13700
+13400 IF C<30000 C=C+1; GOTO 13770
+13410 IF C<30000 C=C+1; GOTO 13840
+13420 IF C<30000 C=C+1; GOTO 13910
+13430 IF C<30000 C=C+1; GOTO 13980
+13440 IF C<30000 C=C+1; GOTO 14050
+13450 IF C<30000 C=C+1; GOTO 14120
+13460 IF C<30000 C=C+1; GOTO 14190
+13470 IF C<30000 C=C+1; GOTO 14260
+13480 IF C<30000 C=C+1; GOTO 14330
+13490 IF C<30000 C=C+1; GOTO 14400
+13500 IF C<30000 C=C+1; GOTO 14470
+13510 IF C<30000 C=C+1; GOTO 14540
+13520 IF C<30000 C=C+1; GOTO 14610
+13530 IF C<30000 C=C+1; GOTO 14680
+13540 IF C<30000 C=C+1; GOTO 14750
+13550 IF C<30000 C=C+1; GOTO 14820
+13560 IF C<30000 C=C+1; GOTO 14890
+13570 IF C<30000 C=C+1; GOTO 14960
+13580 IF C<30000 C=C+1; GOTO 15030
+13590 IF C<30000 C=C+1; GOTO 15100
+13600 IF C<30000 C=C+1; GOTO 15170
+13610 IF C<30000 C=C+1; GOTO 15240
+13620 IF C<30000 C=C+1; GOTO 15310
+13630 IF C<30000 C=C+1; GOTO 15380
+13640 IF C<30000 C=C+1; GOTO 15450
+13650 IF C<30000 C=C+1; GOTO 15520
+13660 IF C<30000 C=C+1; GOTO 15590
+13670 IF C<30000 C=C+1; GOTO 15660
+13680 IF C<30000 C=C+1; GOTO 15730
+13690 IF C<30000 C=C+1; GOTO 15800
+13700 IF C<30000 C=C+1; GOTO 15870
+13710 IF C<30000 C=C+1; GOTO 15940
+13720 IF C<30000 C=C+1; GOTO 16010
+13730 IF C<30000 C=C+1; GOTO 16080
+13740 IF C<30000 C=C+1; GOTO 16150
+13750 IF C<30000 C=C+1; GOTO 16220
+13760 IF C<30000 C=C+1; GOTO 16290
+13770 IF C<30000 C=C+1; GOTO 16360
+13780 IF C<30000 C=C+1; GOTO 16430
+13790 IF C<30000 C=C+1; GOTO 16500
+13800 IF C<30000 C=C+1; GOTO 16570
+13810 IF C<30000 C=C+1; GOTO 16640
+13820 IF C<30000 C=C+1; GOTO 16710
+13830 IF C<30000 C=C+1; GOTO 16780
+13840 IF C<30000 C=C+1; GOTO 16850
+13850 IF C<30000 C=C+1; GOTO 16920
+13860 IF C<30000 C=C+1; GOTO 16990
+13870 IF C<30000 C=C+1; GOTO 17060
+13880 IF C<30000 C=C+1; GOTO 17130
+13890 IF C<30000 C=C+1; GOTO 17200
+13900 IF C<30000 C=C+1; GOTO 17270
+13910 IF C<30000 C=C+1; GOTO 17340
+13920 IF C<30000 C=C+1; GOTO 17410
+13930 IF C<30000 C=C+1; GOTO 17480
+13940 IF C<30000 C=C+1; GOTO 17550
+13950 IF C<30000 C=C+1; GOTO 17620
+13960 IF C<30000 C=C+1; GOTO 17690
+13970 IF C<30000 C=C+1; GOTO 17760
+13980 IF C<30000 C=C+1; GOTO 17830
+13990 IF C<30000 C=C+1; GOTO 17900
+14000 IF C<30000 C=C+1; GOTO 17970
+14010 IF C<30000 C=C+1; GOTO 18040
+14020 IF C<30000 C=C+1; GOTO 18110
+14030 IF C<30000 C=C+1; GOTO 18180
+14040 IF C<30000 C=C+1; GOTO 18250
+14050 IF C<30000 C=C+1; GOTO 18320
+14060 IF C<30000 C=C+1; GOTO 18390
+14070 IF C<30000 C=C+1; GOTO 18460
+14080 IF C<30000 C=C+1; GOTO 18530
+14090 IF C<30000 C=C+1; GOTO 18600
+14100 IF C<30000 C=C+1; GOTO 18670
+14110 IF C<30000 C=C+1; GOTO 18740
+14120 IF C<30000 C=C+1; GOTO 18810
+14130 IF C<30000 C=C+1; GOTO 18880
+14140 IF C<30000 C=C+1; GOTO 18950
+14150 IF C<30000 C=C+1; GOTO 19020
+14160 IF C<30000 C=C+1; GOTO 19090
+14170 IF C<30000 C=C+1; GOTO 19160
+14180 IF C<30000 C=C+1; GOTO 19230
+14190 IF C<30000 C=C+1; GOTO 19300
+14200 IF C<30000 C=C+1; GOTO 19370
+14210 IF C<30000 C=C+1; GOTO 19440
+14220 IF C<30000 C=C+1; GOTO 19510
+14230 IF C<30000 C=C+1; GOTO 19580
+14240 IF C<30000 C=C+1; GOTO 19650
+14250 IF C<30000 C=C+1; GOTO 19720
+14260 IF C<30000 C=C+1; GOTO 19790
+14270 IF C<30000 C=C+1; GOTO 19860
+14280 IF C<30000 C=C+1; GOTO 19930
+14290 IF C<30000 C=C+1; GOTO 20000
+14300 IF C<30000 C=C+1; GOTO 70
+14310 IF C<30000 C=C+1; GOTO 140
+14320 IF C<30000 C=C+1; GOTO 210
+14330 IF C<30000 C=C+1; GOTO 280
+14340 IF C<30000 C=C+1; GOTO 350
+14350 IF C<30000 C=C+1; GOTO 420
+14360 IF C<30000 C=C+1; GOTO 490
+14370 IF C<30000 C=C+1; GOTO 560
+14380 IF C<30000 C=C+1; GOTO 630
+14390 IF C<30000 C=C+1; GOTO 700
+14400 IF C<30000 C=C+1; GOTO 770
+14410 IF C<30000 C=C+1; GOTO 840
+14420 IF C<30000 C=C+1; GOTO 910
+14430 IF C<30000 C=C+1; GOTO 980
+14440 IF C<30000 C=C+1; GOTO 1050
+14450 IF C<30000 C=C+1; GOTO 1120
+14460 IF C<30000 C=C+1; GOTO 1190
+14470 IF C<30000 C=C+1; GOTO 1260
+14480 IF C<30000 C=C+1; GOTO 1330
+14490 IF C<30000 C=C+1; GOTO 1400
+14500 IF C<30000 C=C+1; GOTO 1470
+14510 IF C<30000 C=C+1; GOTO 1540
+14520 IF C<30000 C=C+1; GOTO 1610
+14530 IF C<30000 C=C+1; GOTO 1680
+14540 IF C<30000 C=C+1; GOTO 1750
+14550 IF C<30000 C=C+1; GOTO 1820
+14560 IF C<30000 C=C+1; GOTO 1890
+14570 IF C<30000 C=C+1; GOTO 1960
+14580 IF C<30000 C=C+1; GOTO 2030
+14590 IF C<30000 C=C+1; GOTO 2100
+14600 IF C<30000 C=C+1; GOTO 2170
+14610 IF C<30000 C=C+1; GOTO 2240
+14620 IF C<30000 C=C+1; GOTO 2310
+14630 IF C<30000 C=C+1; GOTO 2380
+14640 IF C<30000 C=C+1; GOTO 2450
+14650 IF C<30000 C=C+1; GOTO 2520
+14660 IF C<30000 C=C+1; GOTO 2590
+14670 IF C<30000 C=C+1; GOTO 2660
+14680 IF C<30000 C=C+1; GOTO 2730
+14690 IF C<30000 C=C+1; GOTO 2800
+14700 IF C<30000 C=C+1; GOTO 2870
+14710 IF C<30000 C=C+1; GOTO 2940
+14720 IF C<30000 C=C+1; GOTO 3010
+14730 IF C<30000 C=C+1; GOTO 3080
+14740 IF C<30000 C=C+1; GOTO 3150
+14750 IF C<30000 C=C+1; GOTO 3220
+14760 IF C<30000 C=C+1; GOTO 3290
+14770 IF C<30000 C=C+1; GOTO 3360
+14780 IF C<30000 C=C+1; GOTO 3430
+14790 IF C<30000 C=C+1; GOTO 3500
+14800 IF C<30000 C=C+1; GOTO 3570
+14810 IF C<30000 C=C+1; GOTO 3640
+14820 IF C<30000 C=C+1; GOTO 3710
+14830 IF C<30000 C=C+1; GOTO 3780
+14840 IF C<30000 C=C+1; GOTO 3850
+14850 IF C<30000 C=C+1; GOTO 3920
+14860 IF C<30000 C=C+1; GOTO 3990
+14870 IF C<30000 C=C+1; GOTO 4060
+14880 IF C<30000 C=C+1; GOTO 4130
+14890 IF C<30000 C=C+1; GOTO 4200
+14900 IF C<30000 C=C+1; GOTO 4270
+14910 IF C<30000 C=C+1; GOTO 4340
+14920 IF C<30000 C=C+1; GOTO 4410
+14930 IF C<30000 C=C+1; GOTO 4480
+14940 IF C<30000 C=C+1; GOTO 4550
+14950 IF C<30000 C=C+1; GOTO 4620
+14960 IF C<30000 C=C+1; GOTO 4690
+14970 IF C<30000 C=C+1; GOTO 4760
+14980 IF C<30000 C=C+1; GOTO 4830
+14990 IF C<30000 C=C+1; GOTO 4900
+15000 IF C<30000 C=C+1; GOTO 4970
+15010 IF C<30000 C=C+1; GOTO 5040
+15020 IF C<30000 C=C+1; GOTO 5110
+15030 IF C<30000 C=C+1; GOTO 5180
+15040 IF C<30000 C=C+1; GOTO 5250
+15050 IF C<30000 C=C+1; GOTO 5320
+15060 IF C<30000 C=C+1; GOTO 5390
+15070 IF C<30000 C=C+1; GOTO 5460
+15080 IF C<30000 C=C+1; GOTO 5530
+15090 IF C<30000 C=C+1; GOTO 5600
+15100 IF C<30000 C=C+1; GOTO 5670
+15110 IF C<30000 C=C+1; GOTO 5740
+15120 IF C<30000 C=C+1; GOTO 5810
+15130 IF C<30000 C=C+1; GOTO 5880
+15140 IF C<30000 C=C+1; GOTO 5950
+15150 IF C<30000 C=C+1; GOTO 6020
+15160 IF C<30000 C=C+1; GOTO 6090
+15170 IF C<30000 C=C+1; GOTO 6160
+15180 IF C<30000 C=C+1; GOTO 6230
+15190 IF C<30000 C=C+1; GOTO 6300
+15200 IF C<30000 C=C+1; GOTO 6370
+15210 IF C<30000 C=C+1; GOTO 6440
+15220 IF C<30000 C=C+1; GOTO 6510
+15230 IF C<30000 C=C+1; GOTO 6580
+15240 IF C<30000 C=C+1; GOTO 6650
+15250 IF C<30000 C=C+1; GOTO 6720
+15260 IF C<30000 C=C+1; GOTO 6790
+15270 IF C<30000 C=C+1; GOTO 6860
+15280 IF C<30000 C=C+1; GOTO 6930
+15290 IF C<30000 C=C+1; GOTO 7000
+15300 IF C<30000 C=C+1; GOTO 7070
+15310 IF C<30000 C=C+1; GOTO 7140
+15320 IF C<30000 C=C+1; GOTO 7210
+15330 IF C<30000 C=C+1; GOTO 7280
+15340 IF C<30000 C=C+1; GOTO 7350
+15350 IF C<30000 C=C+1; GOTO 7420
+15360 IF C<30000 C=C+1; GOTO 7490
+15370 IF C<30000 C=C+1; GOTO 7560
+15380 IF C<30000 C=C+1; GOTO 7630
+15390 IF C<30000 C=C+1; GOTO 7700
+15400 IF C<30000 C=C+1; GOTO 7770
+15410 IF C<30000 C=C+1; GOTO 7840
+15420 IF C<30000 C=C+1; GOTO 7910
+15430 IF C<30000 C=C+1; GOTO 7980
+15440 IF C<30000 C=C+1; GOTO 8050
+15450 IF C<30000 C=C+1; GOTO 8120
+15460 IF C<30000 C=C+1; GOTO 8190
+15470 IF C<30000 C=C+1; GOTO 8260
+15480 IF C<30000 C=C+1; GOTO 8330
+15490 IF C<30000 C=C+1; GOTO 8400
+15500 IF C<30000 C=C+1; GOTO 8470
+15510 IF C<30000 C=C+1; GOTO 8540
+15520 IF C<30000 C=C+1; GOTO 8610
+15530 IF C<30000 C=C+1; GOTO 8680
+15540 IF C<30000 C=C+1; GOTO 8750
+15550 IF C<30000 C=C+1; GOTO 8820
+15560 IF C<30000 C=C+1; GOTO 8890
+15570 IF C<30000 C=C+1; GOTO 8960
+15580 IF C<30000 C=C+1; GOTO 9030
+15590 IF C<30000 C=C+1; GOTO 9100
+15600 IF C<30000 C=C+1; GOTO 9170
+15610 IF C<30000 C=C+1; GOTO 9240
+15620 IF C<30000 C=C+1; GOTO 9310
+15630 IF C<30000 C=C+1; GOTO 9380
+15640 IF C<30000 C=C+1; GOTO 9450
+15650 IF C<30000 C=C+1; GOTO 9520
+15660 IF C<30000 C=C+1; GOTO 9590
+15670 IF C<30000 C=C+1; GOTO 9660
+15680 IF C<30000 C=C+1; GOTO 9730
+15690 IF C<30000 C=C+1; GOTO 9800
+15700 IF C<30000 C=C+1; GOTO 9870
+15710 IF C<30000 C=C+1; GOTO 9940
+15720 IF C<30000 C=C+1; GOTO 10010
+15730 IF C<30000 C=C+1; GOTO 10080
+15740 IF C<30000 C=C+1; GOTO 10150
+15750 IF C<30000 C=C+1; GOTO 10220
+15760 IF C<30000 C=C+1; GOTO 10290
+15770 IF C<30000 C=C+1; GOTO 10360
+15780 IF C<30000 C=C+1; GOTO 10430
+15790 IF C<30000 C=C+1; GOTO 10500
+15800 IF C<30000 C=C+1; GOTO 10570
+15810 IF C<30000 C=C+1; GOTO 10640
+15820 IF C<30000 C=C+1; GOTO 10710
+15830 IF C<30000 C=C+1; GOTO 10780
+15840 IF C<30000 C=C+1; GOTO 10850
+15850 IF C<30000 C=C+1; GOTO 10920
+15860 IF C<30000 C=C+1; GOTO 10990
+15870 IF C<30000 C=C+1; GOTO 11060
+15880 IF C<30000 C=C+1; GOTO 11130
+15890 IF C<30000 C=C+1; GOTO 11200
+15900 IF C<30000 C=C+1; GOTO 11270
+15910 IF C<30000 C=C+1; GOTO 11340
+15920 IF C<30000 C=C+1; GOTO 11410
+15930 IF C<30000 C=C+1; GOTO 11480
+15940 IF C<30000 C=C+1; GOTO 11550
+15950 IF C<30000 C=C+1; GOTO 11620
+15960 IF C<30000 C=C+1; GOTO 11690
+15970 IF C<30000 C=C+1; GOTO 11760
+15980 IF C<30000 C=C+1; GOTO 11830
+15990 IF C<30000 C=C+1; GOTO 11900
+16000 IF C<30000 C=C+1; GOTO 11970
+16010 IF C<30000 C=C+1; GOTO 12040
+16020 IF C<30000 C=C+1; GOTO 12110
+16030 IF C<30000 C=C+1; GOTO 12180
+16040 IF C<30000 C=C+1; GOTO 12250
+16050 IF C<30000 C=C+1; GOTO 12320
+16060 IF C<30000 C=C+1; GOTO 12390
+16070 IF C<30000 C=C+1; GOTO 12460
+16080 IF C<30000 C=C+1; GOTO 12530
+16090 IF C<30000 C=C+1; GOTO 12600
+16100 IF C<30000 C=C+1; GOTO 12670
+16110 IF C<30000 C=C+1; GOTO 12740
+16120 IF C<30000 C=C+1; GOTO 12810
+16130 IF C<30000 C=C+1; GOTO 12880
+16140 IF C<30000 C=C+1; GOTO 12950
+16150 IF C<30000 C=C+1; GOTO 13020
+16160 IF C<30000 C=C+1; GOTO 13090
+16170 IF C<30000 C=C+1; GOTO 13160
+16180 IF C<30000 C=C+1; GOTO 13230
+16190 IF C<30000 C=C+1; GOTO 13300
+16200 IF C<30000 C=C+1; GOTO 13370
+16210 IF C<30000 C=C+1; GOTO 13440
+16220 IF C<30000 C=C+1; GOTO 13510
+16230 IF C<30000 C=C+1; GOTO 13580
+16240 IF C<30000 C=C+1; GOTO 13650
+16250 IF C<30000 C=C+1; GOTO 13720
+16260 IF C<30000 C=C+1; GOTO 13790
+16270 IF C<30000 C=C+1; GOTO 13860
+16280 IF C<30000 C=C+1; GOTO 13930
+16290 IF C<30000 C=C+1; GOTO 14000
+16300 IF C<30000 C=C+1; GOTO 14070
+16310 IF C<30000 C=C+1; GOTO 14140
+16320 IF C<30000 C=C+1; GOTO 14210
+16330 IF C<30000 C=C+1; GOTO 14280
+16340 IF C<30000 C=C+1; GOTO 14350
+16350 IF C<30000 C=C+1; GOTO 14420
+16360 IF C<30000 C=C+1; GOTO 14490
+16370 IF C<30000 C=C+1; GOTO 14560
+16380 IF C<30000 C=C+1; GOTO 14630
+16390 IF C<30000 C=C+1; GOTO 14700
+16400 IF C<30000 C=C+1; GOTO 14770
+16410 IF C<30000 C=C+1; GOTO 14840
+16420 IF C<30000 C=C+1; GOTO 14910
+16430 IF C<30000 C=C+1; GOTO 14980
+16440 IF C<30000 C=C+1; GOTO 15050
+16450 IF C<30000 C=C+1; GOTO 15120
+16460 IF C<30000 C=C+1; GOTO 15190
+16470 IF C<30000 C=C+1; GOTO 15260
+16480 IF C<30000 C=C+1; GOTO 15330
+16490 IF C<30000 C=C+1; GOTO 15400
+16500 IF C<30000 C=C+1; GOTO 15470
+16510 IF C<30000 C=C+1; GOTO 15540
+16520 IF C<30000 C=C+1; GOTO 15610
+16530 IF C<30000 C=C+1; GOTO 15680
+16540 IF C<30000 C=C+1; GOTO 15750
+16550 IF C<30000 C=C+1; GOTO 15820
+16560 IF C<30000 C=C+1; GOTO 15890
+16570 IF C<30000 C=C+1; GOTO 15960
+16580 IF C<30000 C=C+1; GOTO 16030
+16590 IF C<30000 C=C+1; GOTO 16100
+16600 IF C<30000 C=C+1; GOTO 16170
+16610 IF C<30000 C=C+1; GOTO 16240
+16620 IF C<30000 C=C+1; GOTO 16310
+16630 IF C<30000 C=C+1; GOTO 16380
+16640 IF C<30000 C=C+1; GOTO 16450
+16650 IF C<30000 C=C+1; GOTO 16520
+16660 IF C<30000 C=C+1; GOTO 16590
+16670 IF C<30000 C=C+1; GOTO 16660
+16680 IF C<30000 C=C+1; GOTO 16730
+16690 IF C<30000 C=C+1; GOTO 16800
+16700 IF C<30000 C=C+1; GOTO 16870
+16710 IF C<30000 C=C+1; GOTO 16940
+16720 IF C<30000 C=C+1; GOTO 17010
+16730 IF C<30000 C=C+1; GOTO 17080
+16740 IF C<30000 C=C+1; GOTO 17150
+16750 IF C<30000 C=C+1; GOTO 17220
+16760 IF C<30000 C=C+1; GOTO 17290
+16770 IF C<30000 C=C+1; GOTO 17360
+16780 IF C<30000 C=C+1; GOTO 17430
+16790 IF C<30000 C=C+1; GOTO 17500
+16800 IF C<30000 C=C+1; GOTO 17570
+16810 IF C<30000 C=C+1; GOTO 17640
+16820 IF C<30000 C=C+1; GOTO 17710
+16830 IF C<30000 C=C+1; GOTO 17780
+16840 IF C<30000 C=C+1; GOTO 17850
+16850 IF C<30000 C=C+1; GOTO 17920
+16860 IF C<30000 C=C+1; GOTO 17990
+16870 IF C<30000 C=C+1; GOTO 18060
+16880 IF C<30000 C=C+1; GOTO 18130
+16890 IF C<30000 C=C+1; GOTO 18200
+16900 IF C<30000 C=C+1; GOTO 18270
+16910 IF C<30000 C=C+1; GOTO 18340
+16920 IF C<30000 C=C+1; GOTO 18410
+16930 IF C<30000 C=C+1; GOTO 18480
+16940 IF C<30000 C=C+1; GOTO 18550
+16950 IF C<30000 C=C+1; GOTO 18620
+16960 IF C<30000 C=C+1; GOTO 18690
+16970 IF C<30000 C=C+1; GOTO 18760
+16980 IF C<30000 C=C+1; GOTO 18830
+16990 IF C<30000 C=C+1; GOTO 18900
+17000 IF C<30000 C=C+1; GOTO 18970
+17010 IF C<30000 C=C+1; GOTO 19040
+17020 IF C<30000 C=C+1; GOTO 19110
+17030 IF C<30000 C=C+1; GOTO 19180
+17040 IF C<30000 C=C+1; GOTO 19250
+17050 IF C<30000 C=C+1; GOTO 19320
+17060 IF C<30000 C=C+1; GOTO 19390
+17070 IF C<30000 C=C+1; GOTO 19460
+17080 IF C<30000 C=C+1; GOTO 19530
+17090 IF C<30000 C=C+1; GOTO 19600
+17100 IF C<30000 C=C+1; GOTO 19670
+17110 IF C<30000 C=C+1; GOTO 19740
+17120 IF C<30000 C=C+1; GOTO 19810
+17130 IF C<30000 C=C+1; GOTO 19880
+17140 IF C<30000 C=C+1; GOTO 19950
+17150 IF C<30000 C=C+1; GOTO 20
+17160 IF C<30000 C=C+1; GOTO 90
+17170 IF C<30000 C=C+1; GOTO 160
+17180 IF C<30000 C=C+1; GOTO 230
+17190 IF C<30000 C=C+1; GOTO 300
+17200 IF C<30000 C=C+1; GOTO 370
+17210 IF C<30000 C=C+1; GOTO 440
+17220 IF C<30000 C=C+1; GOTO 510
+17230 IF C<30000 C=C+1; GOTO 580
+17240 IF C<30000 C=C+1; GOTO 650
+17250 IF C<30000 C=C+1; GOTO 720
+17260 IF C<30000 C=C+1; GOTO 790
+17270 IF C<30000 C=C+1; GOTO 860
+17280 IF C<30000 C=C+1; GOTO 930
+17290 IF C<30000 C=C+1; GOTO 1000
+17300 IF C<30000 C=C+1; GOTO 1070
+17310 IF C<30000 C=C+1; GOTO 1140
+17320 IF C<30000 C=C+1; GOTO 1210
+17330 IF C<30000 C=C+1; GOTO 1280
+17340 IF C<30000 C=C+1; GOTO 1350
+17350 IF C<30000 C=C+1; GOTO 1420
+17360 IF C<30000 C=C+1; GOTO 1490
+17370 IF C<30000 C=C+1; GOTO 1560
+17380 IF C<30000 C=C+1; GOTO 1630
+17390 IF C<30000 C=C+1; GOTO 1700
+17400 IF C<30000 C=C+1; GOTO 1770
+17410 IF C<30000 C=C+1; GOTO 1840
+17420 IF C<30000 C=C+1; GOTO 1910
+17430 IF C<30000 C=C+1; GOTO 1980
+17440 IF C<30000 C=C+1; GOTO 2050
+17450 IF C<30000 C=C+1; GOTO 2120
+17460 IF C<30000 C=C+1; GOTO 2190
+17470 IF C<30000 C=C+1; GOTO 2260
+17480 IF C<30000 C=C+1; GOTO 2330
+17490 IF C<30000 C=C+1; GOTO 2400
+17500 IF C<30000 C=C+1; GOTO 2470
+17510 IF C<30000 C=C+1; GOTO 2540
+17520 IF C<30000 C=C+1; GOTO 2610
+17530 IF C<30000 C=C+1; GOTO 2680
+17540 IF C<30000 C=C+1; GOTO 2750
+17550 IF C<30000 C=C+1; GOTO 2820
+17560 IF C<30000 C=C+1; GOTO 2890
+17570 IF C<30000 C=C+1; GOTO 2960
+17580 IF C<30000 C=C+1; GOTO 3030
+17590 IF C<30000 C=C+1; GOTO 3100
+17600 IF C<30000 C=C+1; GOTO 3170
+17610 IF C<30000 C=C+1; GOTO 3240
+17620 IF C<30000 C=C+1; GOTO 3310
+17630 IF C<30000 C=C+1; GOTO 3380
+17640 IF C<30000 C=C+1; GOTO 3450
+17650 IF C<30000 C=C+1; GOTO 3520
+17660 IF C<30000 C=C+1; GOTO 3590
+17670 IF C<30000 C=C+1; GOTO 3660
+17680 IF C<30000 C=C+1; GOTO 3730
+17690 IF C<30000 C=C+1; GOTO 3800
+17700 IF C<30000 C=C+1; GOTO 3870
+17710 IF C<30000 C=C+1; GOTO 3940
+17720 IF C<30000 C=C+1; GOTO 4010
+17730 IF C<30000 C=C+1; GOTO 4080
+17740 IF C<30000 C=C+1; GOTO 4150
+17750 IF C<30000 C=C+1; GOTO 4220
+17760 IF C<30000 C=C+1; GOTO 4290
+17770 IF C<30000 C=C+1; GOTO 4360
+17780 IF C<30000 C=C+1; GOTO 4430
+17790 IF C<30000 C=C+1; GOTO 4500
+17800 IF C<30000 C=C+1; GOTO 4570
+17810 IF C<30000 C=C+1; GOTO 4640
+17820 IF C<30000 C=C+1; GOTO 4710
+17830 IF C<30000 C=C+1; GOTO 4780
+17840 IF C<30000 C=C+1; GOTO 4850
+17850 IF C<30000 C=C+1; GOTO 4920
+17860 IF C<30000 C=C+1; GOTO 4990
+17870 IF C<30000 C=C+1; GOTO 5060
+17880 IF C<30000 C=C+1; GOTO 5130
+17890 IF C<30000 C=C+1; GOTO 5200
+17900 IF C<30000 C=C+1; GOTO 5270
+17910 IF C<30000 C=C+1; GOTO 5340
+17920 IF C<30000 C=C+1; GOTO 5410
+17930 IF C<30000 C=C+1; GOTO 5480
+17940 IF C<30000 C=C+1; GOTO 5550
+17950 IF C<30000 C=C+1; GOTO 5620
+17960 IF C<30000 C=C+1; GOTO 5690
+17970 IF C<30000 C=C+1; GOTO 5760
+17980 IF C<30000 C=C+1; GOTO 5830
+17990 IF C<30000 C=C+1; GOTO 5900
+18000 IF C<30000 C=C+1; GOTO 5970
+18010 IF C<30000 C=C+1; GOTO 6040
+18020 IF C<30000 C=C+1; GOTO 6110
+18030 IF C<30000 C=C+1; GOTO 6180
+18040 IF C<30000 C=C+1; GOTO 6250
+18050 IF C<30000 C=C+1; GOTO 6320
+18060 IF C<30000 C=C+1; GOTO 6390
+18070 IF C<30000 C=C+1; GOTO 6460
+18080 IF C<30000 C=C+1; GOTO 6530
+18090 IF C<30000 C=C+1; GOTO 6600
+18100 IF C<30000 C=C+1; GOTO 6670
+18110 IF C<30000 C=C+1; GOTO 6740
+18120 IF C<30000 C=C+1; GOTO 6810
+18130 IF C<30000 C=C+1; GOTO 6880
+18140 IF C<30000 C=C+1; GOTO 6950
+18150 IF C<30000 C=C+1; GOTO 7020
+18160 IF C<30000 C=C+1; GOTO 7090
+18170 IF C<30000 C=C+1; GOTO 7160
+18180 IF C<30000 C=C+1; GOTO 7230
+18190 IF C<30000 C=C+1; GOTO 7300
+18200 IF C<30000 C=C+1; GOTO 7370
+18210 IF C<30000 C=C+1; GOTO 7440
+18220 IF C<30000 C=C+1; GOTO 7510
+18230 IF C<30000 C=C+1; GOTO 7580
+18240 IF C<30000 C=C+1; GOTO 7650
+18250 IF C<30000 C=C+1; GOTO 7720
+18260 IF C<30000 C=C+1; GOTO 7790
+18270 IF C<30000 C=C+1; GOTO 7860
+18280 IF C<30000 C=C+1; GOTO 7930
+18290 IF C<30000 C=C+1; GOTO 8000
+18300 IF C<30000 C=C+1; GOTO 8070
+18310 IF C<30000 C=C+1; GOTO 8140
+18320 IF C<30000 C=C+1; GOTO 8210
+18330 IF C<30000 C=C+1; GOTO 8280
+18340 IF C<30000 C=C+1; GOTO 8350
+18350 IF C<30000 C=C+1; GOTO 8420
+18360 IF C<30000 C=C+1; GOTO 8490
+18370 IF C<30000 C=C+1; GOTO 8560
+18380 IF C<30000 C=C+1; GOTO 8630
+18390 IF C<30000 C=C+1; GOTO 8700
+18400 IF C<30000 C=C+1; GOTO 8770
+18410 IF C<30000 C=C+1; GOTO 8840
+18420 IF C<30000 C=C+1; GOTO 8910
+18430 IF C<30000 C=C+1; GOTO 8980
+18440 IF C<30000 C=C+1; GOTO 9050
+18450 IF C<30000 C=C+1; GOTO 9120
+18460 IF C<30000 C=C+1; GOTO 9190
+18470 IF C<30000 C=C+1; GOTO 9260
+18480 IF C<30000 C=C+1; GOTO 9330
+18490 IF C<30000 C=C+1; GOTO 9400
+18500 IF C<30000 C=C+1; GOTO 9470
+18510 IF C<30000 C=C+1; GOTO 9540
+18520 IF C<30000 C=C+1; GOTO 9610
+18530 IF C<30000 C=C+1; GOTO 9680
+18540 IF C<30000 C=C+1; GOTO 9750
+18550 IF C<30000 C=C+1; GOTO 9820
+18560 IF C<30000 C=C+1; GOTO 9890
+18570 IF C<30000 C=C+1; GOTO 9960
+18580 IF C<30000 C=C+1; GOTO 10030
+18590 IF C<30000 C=C+1; GOTO 10100
+18600 IF C<30000 C=C+1; GOTO 10170
+18610 IF C<30000 C=C+1; GOTO 10240
+18620 IF C<30000 C=C+1; GOTO 10310
+18630 IF C<30000 C=C+1; GOTO 10380
+18640 IF C<30000 C=C+1; GOTO 10450
+18650 IF C<30000 C=C+1; GOTO 10520
+18660 IF C<30000 C=C+1; GOTO 10590
+18670 IF C<30000 C=C+1; GOTO 10660
+18680 IF C<30000 C=C+1; GOTO 10730
+18690 IF C<30000 C=C+1; GOTO 10800
+18700 IF C<30000 C=C+1; GOTO 10870
+18710 IF C<30000 C=C+1; GOTO 10940
+18720 IF C<30000 C=C+1; GOTO 11010
+18730 IF C<30000 C=C+1; GOTO 11080
+18740 IF C<30000 C=C+1; GOTO 11150
+18750 IF C<30000 C=C+1; GOTO 11220
+18760 IF C<30000 C=C+1; GOTO 11290
+18770 IF C<30000 C=C+1; GOTO 11360
+18780 IF C<30000 C=C+1; GOTO 11430
+18790 IF C<30000 C=C+1; GOTO 11500
+18800 IF C<30000 C=C+1; GOTO 11570
+18810 IF C<30000 C=C+1; GOTO 11640
+18820 IF C<30000 C=C+1; GOTO 11710
+18830 IF C<30000 C=C+1; GOTO 11780
+18840 IF C<30000 C=C+1; GOTO 11850
+18850 IF C<30000 C=C+1; GOTO 11920
+18860 IF C<30000 C=C+1; GOTO 11990
+18870 IF C<30000 C=C+1; GOTO 12060
+18880 IF C<30000 C=C+1; GOTO 12130
+18890 IF C<30000 C=C+1; GOTO 12200
+18900 IF C<30000 C=C+1; GOTO 12270
+18910 IF C<30000 C=C+1; GOTO 12340
+18920 IF C<30000 C=C+1; GOTO 12410
+18930 IF C<30000 C=C+1; GOTO 12480
+18940 IF C<30000 C=C+1; GOTO 12550
+18950 IF C<30000 C=C+1; GOTO 12620
+18960 IF C<30000 C=C+1; GOTO 12690
+18970 IF C<30000 C=C+1; GOTO 12760
+18980 IF C<30000 C=C+1; GOTO 12830
+18990 IF C<30000 C=C+1; GOTO 12900
+19000 IF C<30000 C=C+1; GOTO 12970
+19010 IF C<30000 C=C+1; GOTO 13040
+19020 IF C<30000 C=C+1; GOTO 13110
+19030 IF C<30000 C=C+1; GOTO 13180
+19040 IF C<30000 C=C+1; GOTO 13250
+19050 IF C<30000 C=C+1; GOTO 13320
+19060 IF C<30000 C=C+1; GOTO 13390
+19070 IF C<30000 C=C+1; GOTO 13460
+19080 IF C<30000 C=C+1; GOTO 13530
+19090 IF C<30000 C=C+1; GOTO 13600
+19100 IF C<30000 C=C+1; GOTO 13670
+19110 IF C<30000 C=C+1; GOTO 13740
+19120 IF C<30000 C=C+1; GOTO 13810
+19130 IF C<30000 C=C+1; GOTO 13880
+19140 IF C<30000 C=C+1; GOTO 13950
+19150 IF C<30000 C=C+1; GOTO 14020
+19160 IF C<30000 C=C+1; GOTO 14090
+19170 IF C<30000 C=C+1; GOTO 14160
+19180 IF C<30000 C=C+1; GOTO 14230
+19190 IF C<30000 C=C+1; GOTO 14300
+19200 IF C<30000 C=C+1; GOTO 14370
+19210 IF C<30000 C=C+1; GOTO 14440
+19220 IF C<30000 C=C+1; GOTO 14510
+19230 IF C<30000 C=C+1; GOTO 14580
+19240 IF C<30000 C=C+1; GOTO 14650
+19250 IF C<30000 C=C+1; GOTO 14720
+19260 IF C<30000 C=C+1; GOTO 14790
+19270 IF C<30000 C=C+1; GOTO 14860
+19280 IF C<30000 C=C+1; GOTO 14930
+19290 IF C<30000 C=C+1; GOTO 15000
+19300 IF C<30000 C=C+1; GOTO 15070
+19310 IF C<30000 C=C+1; GOTO 15140
+19320 IF C<30000 C=C+1; GOTO 15210
+19330 IF C<30000 C=C+1; GOTO 15280
+19340 IF C<30000 C=C+1; GOTO 15350
+19350 IF C<30000 C=C+1; GOTO 15420
+19360 IF C<30000 C=C+1; GOTO 15490
+19370 IF C<30000 C=C+1; GOTO 15560
+19380 IF C<30000 C=C+1; GOTO 15630
+19390 IF C<30000 C=C+1; GOTO 15700
+19400 IF C<30000 C=C+1; GOTO 15770
+19410 IF C<30000 C=C+1; GOTO 15840
+19420 IF C<30000 C=C+1; GOTO 15910
+19430 IF C<30000 C=C+1; GOTO 15980
+19440 IF C<30000 C=C+1; GOTO 16050
+19450 IF C<30000 C=C+1; GOTO 16120
+19460 IF C<30000 C=C+1; GOTO 16190
+19470 IF C<30000 C=C+1; GOTO 16260
+19480 IF C<30000 C=C+1; GOTO 16330
+19490 IF C<30000 C=C+1; GOTO 16400
+19500 IF C<30000 C=C+1; GOTO 16470
+19510 IF C<30000 C=C+1; GOTO 16540
+19520 IF C<30000 C=C+1; GOTO 16610
+19530 IF C<30000 C=C+1; GOTO 16680
+19540 IF C<30000 C=C+1; GOTO 16750
+19550 IF C<30000 C=C+1; GOTO 16820
+19560 IF C<30000 C=C+1; GOTO 16890
+19570 IF C<30000 C=C+1; GOTO 16960
+19580 IF C<30000 C=C+1; GOTO 17030
+19590 IF C<30000 C=C+1; GOTO 17100
+19600 IF C<30000 C=C+1; GOTO 17170
+19610 IF C<30000 C=C+1; GOTO 17240
+19620 IF C<30000 C=C+1; GOTO 17310
+19630 IF C<30000 C=C+1; GOTO 17380
+19640 IF C<30000 C=C+1; GOTO 17450
+19650 IF C<30000 C=C+1; GOTO 17520
+19660 IF C<30000 C=C+1; GOTO 17590
+19670 IF C<30000 C=C+1; GOTO 17660
+19680 IF C<30000 C=C+1; GOTO 17730
+19690 IF C<30000 C=C+1; GOTO 17800
+19700 IF C<30000 C=C+1; GOTO 17870
+19710 IF C<30000 C=C+1; GOTO 17940
+19720 IF C<30000 C=C+1; GOTO 18010
+19730 IF C<30000 C=C+1; GOTO 18080
+19740 IF C<30000 C=C+1; GOTO 18150
+19750 IF C<30000 C=C+1; GOTO 18220
+19760 IF C<30000 C=C+1; GOTO 18290
+19770 IF C<30000 C=C+1; GOTO 18360
+19780 IF C<30000 C=C+1; GOTO 18430
+19790 IF C<30000 C=C+1; GOTO 18500
+19800 IF C<30000 C=C+1; GOTO 18570
+19810 IF C<30000 C=C+1; GOTO 18640
+19820 IF C<30000 C=C+1; GOTO 18710
+19830 IF C<30000 C=C+1; GOTO 18780
+19840 IF C<30000 C=C+1; GOTO 18850
+19850 IF C<30000 C=C+1; GOTO 18920
+19860 IF C<30000 C=C+1; GOTO 18990
+19870 IF C<30000 C=C+1; GOTO 19060
+19880 IF C<30000 C=C+1; GOTO 19130
+19890 IF C<30000 C=C+1; GOTO 19200
+19900 IF C<30000 C=C+1; GOTO 19270
+19910 IF C<30000 C=C+1; GOTO 19340
+19920 IF C<30000 C=C+1; GOTO 19410
+19930 IF C<30000 C=C+1; GOTO 19480
+19940 IF C<30000 C=C+1; GOTO 19550
+19950 IF C<30000 C=C+1; GOTO 19620
+19960 IF C<30000 C=C+1; GOTO 19690
+19970 IF C<30000 C=C+1; GOTO 19760
+19980 IF C<30000 C=C+1; GOTO 19830
+19990 IF C<30000 C=C+1; GOTO 19900
+20000 IF C<30000 C=C+1; GOTO 19970
+29990 GOTO 3
+30000 PRINT C
+RUN
@@ -0,0 +1,9 @@
+10 REM GOSUB-heavy: 2 levels of subroutine per iteration, 300000 iterations
+20 FOR R=1 TO 10; FOR I=1 TO 30000; GOSUB 100; NEXT I; NEXT R
+30 PRINT A,B
+40 STOP
+100 A=A+1; IF A>999 A=0
+110 GOSUB 200; RETURN
+200 B=B+A; IF B>9999 B=B-9999
+210 RETURN
+RUN
@@ -0,0 +1,251 @@
+/*
+	TOYOSHIKI Tiny BASIC for Linux
+	Microbenchmarks of interpreter primitives
+	Usage: micro
+
+	The interpreter is included whole, so that its internal functions can be
+	called directly on synthetic inputs of growing size.
+*/
+
+#include "../basic.c"
+
+#define MICRO_SECONDS 0.05 // Least time to measure 1 case
+
+// Output is discarded
+void micro_output(void *user, const char *data, size_t len)
+{
+	(void)user;
+	(void)data;
+	(void)len;
+}
+
+double micro_now(void)
+{
+	struct timespec time;
+
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+void micro_report(const char *name, unsigned long size, unsigned long operations, double seconds)
+{
+	printf("%-40s %8lu %12.1f\n", name, size, seconds * 1e9 / operations);
+}
+
+// Make an interpreter with no output
+tb_context *micro_create(unsigned char engine)
+{
+	struct tb_options options;
+	tb_context *tb;
+
+	memset(&options, 0, sizeof(options));
+	options.engine = engine;
+	options.flush_policy = TB_FLUSH_BLOCK;
+	options.output = micro_output;
+	tb = tb_create(&options);
+	if (!tb)
+	{
+		fputs("micro: out of memory\n", stderr);
+		exit(2);
+	}
+	return tb;
+}
+
+// Store a program of line_count lines, numbered 1 up
+void micro_make_program(tb_context *tb, unsigned long line_count)
+{
+	unsigned long i;
+	unsigned short len;
+
+	i_new_command_handler(tb);
+	for (i = 1; i <= line_count; i++)
+	{
+		sprintf(tb->command_line_buffer, "%lu A=A+1", i);
+		len = convert_token_to_icode(tb);
+		insert_icode_to_the_list_preconditions(tb, len);
+	}
+}
+
+// Make an expression of term_count terms without constants
+void micro_make_expression(char *text, unsigned long term_count)
+{
+	static const char *const term[] = {"+B", "+C*D", "-(E+F)", "+ABS(G)", "-H*I", "+@(1)"};
+	unsigned long i;
+
+	*text = 0;
+	for (i = 0; i < term_count; i++)
+		strcat(text, term[i % (sizeof(term) / sizeof(*term))] + !i); // no sign first
+}
+
+void micro_convert_token_to_icode(void)
+{
+	static const unsigned long size[] = {1, 4, 16, 32};
+	tb_context *tb = micro_create(TB_ENGINE_ICODE);
+	char line[SIZE_LINE_COMMAND];
+	unsigned long i, n, count;
+	double start, seconds;
+
+	for (i = 0; i < sizeof(size) / sizeof(*size); i++)
+	{
+		strcpy(line, "10 IF A>=B PRINT \"x\",");
+		micro_make_expression(line + strlen(line), size[i]);
+		for (count = 1;; count *= 2)
+		{
+			start = micro_now();
+			for (n = 0; n < count; n++)
+			{
+				strcpy(tb->command_line_buffer, line);
+				convert_token_to_icode(tb);
+			}
+			seconds = micro_now() - start;
+			if (seconds >= MICRO_SECONDS)
+				break;
+		}
+		micro_report("convert_token_to_icode (terms)", size[i], count, seconds);
+	}
+	tb_destroy(tb);
+}
+
+void micro_the_parser(unsigned char engine, const char *name)
+{
+	static const unsigned long size[] = {1, 4, 16, 32};
+	tb_context *tb = micro_create(engine);
+	unsigned char *expression;
+	unsigned long i, n, count;
+	double start, seconds;
+	char *text;
+
+	for (i = 0; i < sizeof(size) / sizeof(*size); i++)
+	{
+		// Store "1 A=expression" and evaluate it in place
+		i_new_command_handler(tb);
+		tb_set_var(tb, 'B', 3);
+		text = tb->command_line_buffer;
+		strcpy(text, "1 A=");
+		micro_make_expression(text + strlen(text), size[i]);
+		insert_icode_to_the_list_preconditions(tb, convert_token_to_icode(tb));
+		expression = tb->list_area + SIZE_LINE_HEADER + 3; // after I_VAR, A and I_EQ
+		tb->current_line = tb->list_area;
+
+		for (count = 1;; count *= 2)
+		{
+			start = micro_now();
+			for (n = 0; n < count; n++)
+			{
+				tb->current_icode = expression;
+				i_the_parser(tb);
+			}
+			seconds = micro_now() - start;
+			if (seconds >= MICRO_SECONDS)
+				break;
+		}
+		micro_report(name, size[i], count, seconds);
+	}
+	tb_destroy(tb);
+}
+
+void micro_search_line_by_line_number(void)
+{
+	static const unsigned long size[] = {100, 1000, 10000, 30000};
+	tb_context *tb = micro_create(TB_ENGINE_ICODE);
+	unsigned long i, n, count;
+	volatile unsigned char *line_pointer;
+	double start, seconds;
+
+	for (i = 0; i < sizeof(size) / sizeof(*size); i++)
+	{
+		micro_make_program(tb, size[i]);
+		for (count = 1;; count *= 2)
+		{
+			start = micro_now();
+			for (n = 0; n < count; n++)
+				line_pointer = search_line_by_line_number(tb, n * 7919 % size[i] + 1);
+			seconds = micro_now() - start;
+			if (seconds >= MICRO_SECONDS)
+				break;
+		}
+		(void)line_pointer;
+		micro_report("search_line_by_line_number (lines)", size[i], count, seconds);
+	}
+	tb_destroy(tb);
+}
+
+// Insert a line in the middle of programs of growing length, and delete it
+void micro_insert_icode_to_the_list(void)
+{
+	static const unsigned long size[] = {100, 1000, 10000, 16000}; // line numbers up to 32767
+	tb_context *tb = micro_create(TB_ENGINE_ICODE);
+	unsigned char insert_icode[SIZE_IBUFFER], delete_icode[SIZE_IBUFFER];
+	unsigned short insert_length, delete_length;
+	unsigned long i, n, count;
+	double start, seconds;
+
+	for (i = 0; i < sizeof(size) / sizeof(*size); i++)
+	{
+		micro_make_program(tb, size[i] * 2);
+		for (n = 1; n <= size[i] * 2; n += 2)
+		{ // leave even lines only
+			sprintf(tb->command_line_buffer, "%lu", n);
+			insert_icode_to_the_list_preconditions(tb, convert_token_to_icode(tb));
+		}
+		sprintf(tb->command_line_buffer, "%lu A=A+1", size[i] + 1);
+		insert_length = convert_token_to_icode(tb);
+		memcpy(insert_icode, tb->icode_conversion_buffer, insert_length);
+		sprintf(tb->command_line_buffer, "%lu", size[i] + 1);
+		delete_length = convert_token_to_icode(tb);
+		memcpy(delete_icode, tb->icode_conversion_buffer, delete_length);
+
+		for (count = 1;; count *= 2)
+		{
+			start = micro_now();
+			for (n = 0; n < count; n++)
+			{
+				memcpy(tb->icode_conversion_buffer, insert_icode, insert_length);
+				insert_icode_to_the_list_preconditions(tb, insert_length);
+				memcpy(tb->icode_conversion_buffer, delete_icode, delete_length);
+				insert_icode_to_the_list_preconditions(tb, delete_length);
+			}
+			seconds = micro_now() - start;
+			if (seconds >= MICRO_SECONDS)
+				break;
+		}
+		micro_report("insert_icode_to_the_list (lines, +del)", size[i], count, seconds);
+	}
+	tb_destroy(tb);
+}
+
+void micro_print_numeric_specified_columns(void)
+{
+	static const short value[] = {7, -42, 1234, -32767};
+	static const unsigned long digits[] = {1, 2, 4, 5};
+	tb_context *tb = micro_create(TB_ENGINE_ICODE);
+	unsigned long i, n, count;
+	double start, seconds;
+
+	for (i = 0; i < sizeof(value) / sizeof(*value); i++)
+	{
+		for (count = 1;; count *= 2)
+		{
+			start = micro_now();
+			for (n = 0; n < count; n++)
+				print_numeric_specified_columns(tb, value[i], 6);
+			seconds = micro_now() - start;
+			if (seconds >= MICRO_SECONDS)
+				break;
+		}
+		micro_report("print_numeric_specified_columns (digits)", digits[i], count, seconds);
+	}
+	tb_destroy(tb);
+}
+
+int main(void)
+{
+	printf("%-40s %8s %12s\n", "primitive (size of)", "size", "ns/op");
+	micro_convert_token_to_icode();
+	micro_the_parser(TB_ENGINE_ICODE, "i_the_parser, icode (terms)");
+	micro_the_parser(TB_ENGINE_BYTECODE, "i_the_parser, bytecode (terms)");
+	micro_search_line_by_line_number();
+	micro_insert_icode_to_the_list();
+	micro_print_numeric_specified_columns();
+	return 0;
+}
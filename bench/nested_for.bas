@@ -0,0 +1,6 @@
+10 REM Nested FOR loops, 2000000 inner iterations
+20 S=0
+30 FOR I=1 TO 2000; FOR J=1 TO 1000; S=S+J; IF S>9999 S=S-9999
+40 NEXT J; NEXT I
+50 PRINT S
+RUN
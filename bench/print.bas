@@ -0,0 +1,3 @@
+10 REM PRINT-heavy: numbers and strings to the output, 300000 lines
+20 FOR R=1 TO 10; FOR I=1 TO 30000; PRINT #6,I,-I,"abcdefgh",I/7; NEXT I; NEXT R
+RUN
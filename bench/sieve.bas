@@ -0,0 +1,12 @@
+10 REM Prime sieve on @() up to 30000, 5 times
+20 N=30000; R=0
+30 FOR I=2 TO N; @(I)=1; NEXT I
+40 C=0; FOR I=2 TO N
+50 IF @(I)=0 GOTO 90
+60 C=C+1; IF I>181 GOTO 90
+70 J=I*I
+80 IF J<=N @(J)=0; J=J+I; GOTO 80
+90 NEXT I
+100 R=R+1; IF R<5 GOTO 30
+110 PRINT C
+RUN
@@ -0,0 +1,17 @@
+10 REM IF/GOTO state machine: count runs of 1 1 in a pseudo random bit stream
+20 S=0; X=1; C=0; R=0
+25 N=0; R=R+1; IF R>10 GOTO 200
+30 N=N+1; IF N>30000 GOTO 25
+40 X=X*5+3; X=X-X/1000*1000; B=X/500
+50 IF S=0 GOTO 100
+60 IF S=1 GOTO 110
+70 GOTO 120
+100 IF B=1 S=1
+105 GOTO 30
+110 IF B=0 S=0
+115 IF B=1 S=2
+117 GOTO 30
+120 C=C+1; IF C>9999 C=0
+125 S=0; GOTO 30
+200 PRINT C
+RUN
@@ -1,1483 +1,495 @@
 /*
 	TOYOSHIKI Tiny BASIC for Linux
 	(C)2015 Tetsuya Suzuki
-	Build: cc ttbasic.c basic.c -o ttbasic
+	Build: cc main.c basic.c -pthread -o ttbasic
 */
 
-/*
-TO DO:
-The following variables use pointer arithmetic, which is probably a bad idea if
-you want to convert the code to another language:
-  current_icode
-  current_line
-  ip
-  line_pointer
-  keyword_pointer
-  character_in_line_buffer_pointer
-  top_of_command_line
-*/
-
-#include <fcntl.h>
-#include <stdint.h>
+#include <dirent.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
+#include <string.h>
 #include <unistd.h>
 
-void basic(void); // prototype
-
-int main()
-{
-	srand((unsigned int)time(0)); // for RND function
-	basic();					  // call The BASIC
-	return 0;
-}
-
-// Compiler requires description
-
-// TOYOSHIKI TinyBASIC symbols
-// TO-DO Rewrite defined values to fit your machine as needed
-#define SIZE_LINE_COMMAND 78  // Command line buffer length + NULL
-#define SIZE_IBUFFER 78		  // i-code conversion buffer size
-#define SIZE_LIST_BUFFER 1024 // List buffer size
-#define SIZE_ARRAY_AREA 64	// Array area size
-#define SIZE_GOSUB_STACK 6	// GOSUB stack size(2/nest)
-#define SIZE_LSTK 15		  // FOR stack size(5/nest)
-
-#define ASCII_SPACE 32
-#define ASCII_MAX_CHARACTER 127
-#define ASCII_BACKSPACE 8
-#define ASCII_TAB 9
-#define ASCII_CARRIAGE_RETURN 13
-
-#define MAX_BYTE_VALUE 255
-#define BITS_IN_BYTE 8
-
-// Depending on device functions
-// TO-DO Rewrite these functions to fit your machine
-#define STR_EDITION "LINUX"
-
-// Terminal control
-
-char c_kbhit(void)
-{
-	char c;
-	int f;
-
-	f = fcntl(STDIN_FILENO, F_GETFL, 0);
-	fcntl(STDIN_FILENO, F_SETFL, f | O_NONBLOCK);
-
-	c = getchar();
-
-	fcntl(STDIN_FILENO, F_SETFL, f);
-
-	if (c != EOF)
-	{
-		ungetc(c, stdin);
-		return 1;
-	}
-
-	return 0;
-}
-
-#define KEY_ENTER 10
-void newline(void)
-{
-	putchar(KEY_ENTER); // LF
-}
-
-// Return random number
-short get_random_number(short value)
-{
-	return (rand() % value) + 1;
-}
-
-// Prototypes (necessity minimum)
-short i_the_parser(void);
-
-// Keyword table
-const char *keyword_table[] = {
-	"GOTO", "GOSUB", "RETURN",
-	"FOR", "TO", "STEP", "NEXT",
-	"IF", "REM", "STOP",
-	"INPUT", "PRINT", "LET",
-	",", ";",
-	"-", "+", "*", "/", "(", ")",
-	">=", "#", ">", "=", "<=", "<",
-	"@", "RND", "ABS", "SIZE",
-	"LIST", "RUN", "NEW", "SYSTEM"};
-
-// i-code(Intermediate code) assignment
-enum
-{
-	I_GOTO,   // 0 GOTO
-	I_GOSUB,  // 1
-	I_RETURN, // 2
-	I_FOR,	// 3
-	I_TO,	 // 4
-	I_STEP,   // 5
-	I_NEXT,   // 6
-	I_IF,	 // 7
-	I_REM,	// 8
-	I_STOP,   // 9
-	I_INPUT,  // 10
-	I_PRINT,  // 11 PRINT
-	I_LET,	// 12
-	I_COMMA,  // 13
-	I_SEMI,   // 14 Semicolon
-	I_MINUS,  // 15
-	I_PLUS,   // 16
-	I_MUL,	// 17
-	I_DIV,	// 18
-	I_OPEN,   // 19
-	I_CLOSE,  // 20
-	I_GTE,	// 21
-	I_SHARP,  // 22
-	I_GT,	 // 23
-	I_EQ,	 // 24
-	I_LTE,	// 25
-	I_LT,	 // 26
-	I_ARRAY,  // 27
-	I_RND,	// 28
-	I_ABS,	// 29
-	I_SIZE,   // 30
-	I_LIST,   // 31
-	I_RUN,	// 32
-	I_NEW,	// 33
-	I_SYSTEM, // 34
-	I_NUM,	// 35
-	I_VAR,	// 36 Variable
-	I_STR,	// 37
-	I_EOL	 // 38
-};
-
-// Keyword count
-#define SIZE_KEYWORD_TABLE (sizeof(keyword_table) / sizeof(const char *))
+#include "ttbasic.h"
 
-// List formatting condition
-// no space after
-const unsigned char i_no_space_after[] = {
-	I_RETURN, I_STOP, I_COMMA,
-	I_MINUS, I_PLUS, I_MUL, I_DIV, I_OPEN, I_CLOSE,
-	I_GTE, I_SHARP, I_GT, I_EQ, I_LTE, I_LT,
-	I_ARRAY, I_RND, I_ABS, I_SIZE};
+int basic_batch(const char *directory_name, unsigned int thread_count,
+				const struct tb_options *options, unsigned char run,
+				const char *stats_file_name); // prototype
 
-// no space before (after numeric or variable only)
-const unsigned char i_no_space_before[] = {
-	I_MINUS, I_PLUS, I_MUL, I_DIV, I_OPEN, I_CLOSE,
-	I_GTE, I_SHARP, I_GT, I_EQ, I_LTE, I_LT,
-	I_COMMA, I_SEMI, I_EOL};
-
-// exception search function
-char sstyle(unsigned char code, const unsigned char *table, unsigned char count)
-{
-	while (count--)
-		if (code == table[count])
-			return 1;
-	return 0;
-}
-
-// exception search macro
-#define nospacea(c) sstyle(c, i_no_space_after, sizeof(i_no_space_after))
-#define nospaceb(c) sstyle(c, i_no_space_before, sizeof(i_no_space_before))
-
-// Error messages
-unsigned char err; // Error message index
-const char *errmsg[] = {
-	"OK",
-	"Devision by zero",
-	"Overflow",
-	"Subscript out of range",
-	"Icode buffer full",
-	"List full",
-	"GOSUB too many nested",
-	"RETURN stack underflow",
-	"FOR too many nested",
-	"NEXT without FOR",
-	"NEXT without counter",
-	"NEXT mismatch FOR",
-	"FOR without variable",
-	"FOR without TO",
-	"LET without variable",
-	"IF without condition",
-	"Undefined line number",
-	"\'(\' or \')\' expected",
-	"\'=\' expected",
-	"Illegal command",
-	"Syntax error",
-	"Internal error",
-	"Abort by [ESC]"};
-
-// Error code assignment
-enum
-{
-	ERR_OK,
-	ERR_DIVBY0,
-	ERR_VOF,
-	ERR_SOR,
-	ERR_IBUFOF,
-	ERR_LBUFOF,
-	ERR_GSTKOF,
-	ERR_GSTKUF,
-	ERR_LSTKOF,
-	ERR_LSTKUF,
-	ERR_NEXTWOV,
-	ERR_NEXTUM,
-	ERR_FORWOV,
-	ERR_FORWOTO,
-	ERR_LETWOV,
-	ERR_IFWOC,
-	ERR_ULN,
-	ERR_PAREN,
-	ERR_VWOEQ,
-	ERR_COM,
-	ERR_SYNTAX,
-	ERR_SYS,
-	ERR_ESC
-};
-
-// RAM mapping
-char command_line_buffer[SIZE_LINE_COMMAND];		 // Command line buffer
-unsigned char icode_conversion_buffer[SIZE_IBUFFER]; // i-code conversion buffer
-short variable_area[26];							 // Variable area
-short array_area[SIZE_ARRAY_AREA];					 // Array area
-unsigned char list_area[SIZE_LIST_BUFFER];			 // List area
-unsigned char *current_line;						 // Pointer current line
-unsigned char *current_icode;						 // Pointer current Intermediate code
-unsigned char *gosub_stack[SIZE_GOSUB_STACK];		 // GOSUB stack
-unsigned char gosub_stack_index;					 // GOSUB stack index
-unsigned char *for_stack[SIZE_LSTK];				 // FOR stack
-unsigned char for_stack_index;						 // FOR stack index
-
-// Standard C libraly (about) same functions
-char c_toupper(char c) { return (c <= 'z' && c >= 'a' ? c - ASCII_SPACE : c); }
-char c_isprint(char c) { return (c >= ASCII_SPACE && c < ASCII_MAX_CHARACTER); }
-char c_isspace(char c) { return (c == ' ' || (c <= ASCII_CARRIAGE_RETURN && c >= ASCII_TAB)); }
-char c_isdigit(char c) { return (c <= '9' && c >= '0'); }
-char c_isalpha(char c) { return ((c <= 'z' && c >= 'a') || (c <= 'Z' && c >= 'A')); }
-void c_puts(const char *character_in_line_buffer_pointer)
+void usage(void)
 {
-	while (*character_in_line_buffer_pointer)
-		putchar(*character_in_line_buffer_pointer++);
-}
-void c_gets()
-{
-	char c;
-	unsigned char len;
-
-	len = 0;
-	while ((c = getchar()) != KEY_ENTER)
-	{
-		if (c == ASCII_TAB)
-			c = ' '; // TAB exchange Space
-		if (((c == ASCII_BACKSPACE) || (c == ASCII_MAX_CHARACTER)) && (len > 0))
-		{ // Backspace manipulation
-			len--;
-			putchar(ASCII_BACKSPACE);
-			putchar(' ');
-			putchar(ASCII_BACKSPACE);
-		}
-		else if (c_isprint(c) && (len < (SIZE_LINE_COMMAND - 1)))
-		{
-			command_line_buffer[len++] = c;
-			putchar(c);
-		}
-	}
-	newline();
-	command_line_buffer[len] = 0; // Put NULL
-
-	if (len > 0)
-	{
-		while (c_isspace(command_line_buffer[--len]))
-			;							// Skip space
-		command_line_buffer[++len] = 0; // Put NULL
-	}
+	fputs("usage: ttbasic [--flush=line|block] [--engine=icode|bytecode] [--perf]\n"
+		  "               [--array=N] [--array-file=FILE] [--sample=FILE]\n"
+		  "               [--trace=FILE] [--image=FILE] [file] [--run]\n"
+		  "       ttbasic [--engine=icode|bytecode] [--perf] [--array=N]\n"
+		  "               --batch directory [-j N] [--run] [--stats=FILE]\n",
+		  stderr);
+	exit(2);
 }
 
-// Print numeric specified columns
-void print_numeric_specified_columns(short value, short d)
+/*
+Read a whole file
+Return the text, to be freed, or NULL with the reason on standard error
+*/
+char *read_file(const char *file_name, size_t *len)
 {
-	unsigned char i;
-	unsigned char sign;
+	FILE *file;
+	char *text;
+	long size;
 
-	if (value < 0)
-	{
-		sign = 1;
-		value = -value;
-	}
-	else
+	file = fopen(file_name, "rb");
+	if (!file)
 	{
-		sign = 0;
+		perror(file_name);
+		return NULL;
 	}
-
-	command_line_buffer[6] = 0;
-	i = 6;
-	do
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	text = size < 0 ? NULL : malloc(size + 1);
+	if (!text || fread(text, 1, size, file) != (size_t)size)
 	{
-		command_line_buffer[--i] = (value % 10) + '0';
-		value /= 10;
-	} while (value > 0);
-
-	if (sign)
-		command_line_buffer[--i] = '-';
-
-	// String length = 6 - i
-	while (6 - i < d)
-	{				  // If short
-		putchar(' '); // Fill space
-		d--;
+		perror(file_name);
+		fclose(file);
+		free(text);
+		return NULL;
 	}
-	c_puts(&command_line_buffer[i]);
+	fclose(file);
+	*len = size;
+	return text;
 }
 
-// Input numeric and return value
-// Called by only INPUT statement
-short input_numeric_and_return_value()
-{
-	short value, tmp;
-	char c;
-	unsigned char len;
-	unsigned char sign;
-
-	len = 0;
-	while ((c = getchar()) != KEY_ENTER)
+/*
+Run a source file
+Numbered lines are stored, and the others are executed as commands
+Return exit status
+*/
+int basic_file(tb_context *tb, const char *file_name, unsigned char run)
+{
+	char *text;
+	size_t len;
+	int result;
+
+	text = read_file(file_name, &len);
+	if (!text)
+		return 2;
+	result = tb_load_source(tb, text, len);
+	free(text);
+
+	if (result == TB_OK && run)
+		result = tb_run(tb);
+	return result == TB_ERROR ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *file_name = NULL;
+	unsigned char run = 0;
+	struct tb_options options;
+	const char *batch_directory_name = NULL;
+	const char *stats_file_name = NULL;
+	const char *image_file_name = NULL;
+	long thread_count = 0; // as many as processors
+	char *end;
+	tb_context *tb;
+	int status = 0;
+	int i;
+
+	memset(&options, 0, sizeof(options));
+	options.flush_policy = TB_FLUSH_AUTO;
+	options.engine = TB_ENGINE_ICODE;
+	for (i = 1; i < argc; i++)
 	{
-		if (((c == ASCII_BACKSPACE) || (c == ASCII_MAX_CHARACTER)) && (len > 0))
-		{ // Backspace manipulation
-			len--;
-			putchar(ASCII_BACKSPACE);
-			putchar(' ');
-			putchar(ASCII_BACKSPACE);
-		}
-		else if ((len == 0 && (c == '+' || c == '-')) ||
-				 (len < 6 && c_isdigit(c)))
-		{ // Numeric or sign only
-			command_line_buffer[len++] = c;
-			putchar(c);
+		if (strcmp(argv[i], "--run") == 0)
+			run = 1;
+		else if (strcmp(argv[i], "--flush=line") == 0)
+			options.flush_policy = TB_FLUSH_LINE;
+		else if (strcmp(argv[i], "--flush=block") == 0)
+			options.flush_policy = TB_FLUSH_BLOCK;
+		else if (strcmp(argv[i], "--engine=icode") == 0)
+			options.engine = TB_ENGINE_ICODE;
+		else if (strcmp(argv[i], "--engine=bytecode") == 0)
+			options.engine = TB_ENGINE_BYTECODE;
+		else if (strcmp(argv[i], "--perf") == 0)
+			options.perf_counters = 1;
+		else if (strncmp(argv[i], "--array=", 8) == 0)
+		{
+			options.array_size = strtol(argv[i] + 8, &end, 10);
+			if (*end || options.array_size < 1 || options.array_size > TB_ARRAY_MAX)
+				usage();
+		}
+		else if (strncmp(argv[i], "--sample=", 9) == 0 && argv[i][9])
+			options.sample_file_name = argv[i] + 9;
+		else if (strncmp(argv[i], "--image=", 8) == 0 && argv[i][8])
+			image_file_name = argv[i] + 8;
+		else if (strncmp(argv[i], "--trace=", 8) == 0 && argv[i][8])
+			options.trace_file_name = argv[i] + 8;
+		else if (strncmp(argv[i], "--array-file=", 13) == 0 && argv[i][13])
+			options.array_file_name = argv[i] + 13;
+		else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc)
+			batch_directory_name = argv[++i];
+		else if (strncmp(argv[i], "--stats=", 8) == 0 && argv[i][8])
+			stats_file_name = argv[i] + 8;
+		else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+		{
+			thread_count = strtol(argv[++i], &end, 10);
+			if (*end || thread_count < 1)
+				usage();
 		}
+		else if (argv[i][0] == '-' || file_name)
+			usage();
+		else
+			file_name = argv[i];
 	}
-	newline();
-	command_line_buffer[len] = 0;
 
-	switch (command_line_buffer[0])
-	{
-	case '-':
-		sign = 1;
-		len = 1;
-		break;
-	case '+':
-		sign = 0;
-		len = 1;
-		break;
-	default:
-		sign = 0;
-		len = 0;
-		break;
+	if (batch_directory_name)
+	{ // every job has its own output and no input
+		if (file_name || image_file_name || options.array_file_name || options.sample_file_name ||
+			options.trace_file_name || options.flush_policy != TB_FLUSH_AUTO)
+			usage();
+		if (!thread_count)
+			thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+		if (thread_count < 1)
+			thread_count = 1;
+		return basic_batch(batch_directory_name, thread_count, &options, run, stats_file_name);
 	}
+	if (thread_count || stats_file_name || (run && !file_name && !image_file_name))
+		usage();
 
-	value = 0; // Initialize value
-	tmp = 0;   // Temp value
-	while (command_line_buffer[len])
+	tb_watch_escape(); // for [ESC] abort
+	tb = tb_create(&options);
+	if (!tb)
 	{
-		tmp = 10 * value + command_line_buffer[len++] - '0';
-		if (value > tmp)
-		{ // It means overflow
-			err = ERR_VOF;
-		}
-		value = tmp;
+		perror(options.array_file_name ? options.array_file_name : "ttbasic");
+		return 2;
 	}
-	if (sign)
-		return -value;
-	return value;
-}
-
-// Convert token to i-code
-// Return byte length or 0
-unsigned char convert_token_to_icode()
-{
-	unsigned char i;											  // Loop counter(i-code sometime)
-	unsigned char len = 0;										  // byte counter
-	char *keyword_pointer = 0;									  // Temporary keyword pointer
-	char *top_of_command_line;									  // Temporary token pointer
-	char *character_in_line_buffer_pointer = command_line_buffer; // Pointer to character in line buffer
-	char c;														  // Surround the string character, " or '
-	short value;												  // numeric
-	short tmp;													  // numeric for overflow check
-
-	while (*character_in_line_buffer_pointer)
-	{
-		while (c_isspace(*character_in_line_buffer_pointer))
-			character_in_line_buffer_pointer++; // Skip space
-
-		// Try keyword conversion
-		for (i = 0; i < SIZE_KEYWORD_TABLE; i++)
-		{
-			keyword_pointer = (char *)keyword_table[i];				// Point keyword
-			top_of_command_line = character_in_line_buffer_pointer; // Point top of command line
-
-			// Compare 1 keyword
-			while ((*keyword_pointer != 0) && (*keyword_pointer == c_toupper(*top_of_command_line)))
-			{
-				keyword_pointer++;
-				top_of_command_line++;
-			}
-
-			if (*keyword_pointer == 0)
-			{ // Case success
-
-				if (len >= SIZE_IBUFFER - 1)
-				{ // List area full
-					err = ERR_IBUFOF;
-					return 0;
-				}
-
-				// i have i-code
-				icode_conversion_buffer[len++] = i;
-				character_in_line_buffer_pointer = top_of_command_line;
-				break;
-			}
-		}
-
-		// Case statement needs an argument except numeric, variable, or strings
-		if (i == I_REM)
-		{
-			while (c_isspace(*character_in_line_buffer_pointer))
-				character_in_line_buffer_pointer++; // Skip space
-			top_of_command_line = character_in_line_buffer_pointer;
-			for (i = 0; *top_of_command_line++; i++)
-				; // Get length
-			if (len >= SIZE_IBUFFER - 2 - i)
-			{
-				err = ERR_IBUFOF;
-				return 0;
-			}
-			icode_conversion_buffer[len++] = i; // Put length
-			while (i--)
-			{ // Copy strings
-				icode_conversion_buffer[len++] = *character_in_line_buffer_pointer++;
-			}
-			break;
-		}
-
-		if (*keyword_pointer == 0)
-			continue;
-
-		top_of_command_line = character_in_line_buffer_pointer; // Point top of command line
-
-		// Try numeric conversion
-		if (c_isdigit(*top_of_command_line))
-		{
-			value = 0;
-			tmp = 0;
-			do
-			{
-				tmp = 10 * value + *top_of_command_line++ - '0';
-				if (value > tmp)
-				{
-					err = ERR_VOF;
-					return 0;
-				}
-				value = tmp;
-			} while (c_isdigit(*top_of_command_line));
-
-			if (len >= SIZE_IBUFFER - 3)
-			{
-				err = ERR_IBUFOF;
-				return 0;
-			}
-			icode_conversion_buffer[len++] = I_NUM;
-			icode_conversion_buffer[len++] = value & MAX_BYTE_VALUE;
-			icode_conversion_buffer[len++] = value >> BITS_IN_BYTE;
-			character_in_line_buffer_pointer = top_of_command_line;
-		}
-		else if (*character_in_line_buffer_pointer == '\"' || *character_in_line_buffer_pointer == '\'') // Try string conversion
-		{
-			// If start of string
-			c = *character_in_line_buffer_pointer++;
-			top_of_command_line = character_in_line_buffer_pointer;
-			for (i = 0; (*top_of_command_line != c) && c_isprint(*top_of_command_line); i++) // Get length
-				top_of_command_line++;
-			if (len >= SIZE_IBUFFER - 1 - i)
-			{ // List area full
-				err = ERR_IBUFOF;
-				return 0;
-			}
-			icode_conversion_buffer[len++] = I_STR; // Put i-code
-			icode_conversion_buffer[len++] = i;		// Put length
-			while (i--)
-			{ // Put string
-				icode_conversion_buffer[len++] = *character_in_line_buffer_pointer++;
-			}
-			if (*character_in_line_buffer_pointer == c)
-				character_in_line_buffer_pointer++; // Skip " or '
-		}
-		else if (c_isalpha(*top_of_command_line)) // Try conversion
-		{
-			if (len >= SIZE_IBUFFER - 2)
-			{
-				err = ERR_IBUFOF;
-				return 0;
-			}
-			if (len >= 4 && icode_conversion_buffer[len - 2] == I_VAR && icode_conversion_buffer[len - 4] == I_VAR)
-			{					  // Case series of variables
-				err = ERR_SYNTAX; // Syntax error
-				return 0;
-			}
-			icode_conversion_buffer[len++] = I_VAR;									// Put i-code
-			icode_conversion_buffer[len++] = c_toupper(*top_of_command_line) - 'A'; // Put index of variable area
-			character_in_line_buffer_pointer++;
-		}
-		else // Nothing much
-		{
-			err = ERR_SYNTAX;
-			return 0;
-		}
+	if (image_file_name && tb_load_image_file(tb, image_file_name) != TB_OK)
+	{ // program ready to run, with no tokenizing
+		perror(image_file_name);
+		tb_destroy(tb);
+		return 2;
 	}
-	icode_conversion_buffer[len++] = I_EOL; // Put end of line
-	return len;								// Return byte length
-}
-
-// Get line numbere by line pointer
-short get_line_number_by_line_pointer(unsigned char *line_pointer)
-{
-	if (*line_pointer == 0) // end of list
-		return 32767;		// max line bumber
-	return *(line_pointer + 1) | *(line_pointer + 2) << BITS_IN_BYTE;
+	if (file_name)
+		status = basic_file(tb, file_name, run); // run the file without echo
+	else if (run)
+		status = tb_run(tb) == TB_ERROR ? 1 : 0; // run the image
+	else
+		tb_repl(tb); // call The BASIC
+	tb_destroy(tb);
+	return status;
 }
 
-// Search line by line number
-unsigned char *search_line_by_line_number(short line_number)
-{
-	unsigned char *line_pointer;
-
-	for (line_pointer = list_area; *line_pointer; line_pointer += *line_pointer)
-		if (get_line_number_by_line_pointer(line_pointer) >= line_number)
-			break;
-	return line_pointer;
-}
+/*
+Run every source file in a directory on a pool of threads
+Each file is a job with its own interpreter, loaded and run as
+basic_file does. The jobs are shared out to the threads in ranges, and a
+thread that runs out steals half of what is left to another. Captured
+output is written job by job in file name order, each followed by the exit
+status of the job on standard error. With a stats file, the counters of
+every job are written there at the end as a JSON array.
+Return the highest exit status
+*/
 
-// Return free memory size
-short return_free_memory_size()
+// Batch job
+struct batch_job
 {
-	unsigned char *line_pointer;
-
-	for (line_pointer = list_area; *line_pointer; line_pointer += *line_pointer)
-		;
-	return list_area + SIZE_LIST_BUFFER - line_pointer - 1;
-}
+	char *file_name;	  // source file path
+	char *output;		  // captured output
+	size_t output_length; // captured output length
+	int status;			  // exit status
+	char *stats;		  // counters as JSON, or NULL
+	unsigned char done;	  // finished
+};
 
-// Insert i-code to the list
-// Preconditions to do *icode_conversion_buffer = len
-void insert_icode_to_the_list_preconditions()
+// Range of jobs owned by a thread
+struct batch_queue
 {
-	unsigned char *insp;
-	unsigned char *p1, *p2;
-	short len;
-
-	if (return_free_memory_size() < *icode_conversion_buffer)
-	{
-		err = ERR_LBUFOF; // List buffer overflow
-		return;
-	}
-
-	insp = search_line_by_line_number(get_line_number_by_line_pointer(icode_conversion_buffer));
-
-	if (get_line_number_by_line_pointer(insp) == get_line_number_by_line_pointer(icode_conversion_buffer))
-	{ // line number agree
-		p1 = insp;
-		p2 = p1 + *p1;
-		while (len = *p2)
-		{
-			while (len--)
-				*p1++ = *p2++;
-		}
-		*p1 = 0;
-	}
-
-	// Case line number only
-	if (*icode_conversion_buffer == 4)
-		return;
-
-	// Make space
-	for (p1 = insp; *p1; p1 += *p1)
-		;
-	len = p1 - insp + 1;
-	p2 = p1 + *icode_conversion_buffer;
-	while (len--)
-		*p2-- = *p1--;
+	pthread_mutex_t lock; // for next and end
+	unsigned int next;	  // next job to run
+	unsigned int end;	  // end of range
+};
 
-	// Insert
-	len = *icode_conversion_buffer;
-	p1 = insp;
-	p2 = icode_conversion_buffer;
-	while (len--)
-		*p1++ = *p2++;
-}
+// Batch pool
+struct batch_pool
+{
+	struct batch_job *job;			  // jobs in file name order
+	unsigned int job_count;			  // job count
+	struct batch_queue *queue;		  // queue by thread
+	unsigned int thread_count;		  // thread count
+	const struct tb_options *options; // options for every job
+	unsigned char run;				  // run every job after loading
+	unsigned char stats;			  // keep the counters of every job
+	pthread_mutex_t lock;			  // for done of jobs
+	pthread_cond_t job_done;		  // some job finished
+};
 
-// Listing 1 line of i-code
-void listing_1_line_of_icode(unsigned char *ip)
+// Batch thread argument
+struct batch_thread
 {
-	unsigned char i;
-
-	while (*ip != I_EOL)
-	{
-		// Case keyword
-		if (*ip < SIZE_KEYWORD_TABLE)
-		{
-			c_puts(keyword_table[*ip]);
-			if (!nospacea(*ip))
-				putchar(' ');
-			if (*ip == I_REM)
-			{
-				ip++;
-				i = *ip++;
-				while (i--)
-				{
-					putchar(*ip++);
-				}
-				return;
-			}
-			ip++;
-		}
-		else if (*ip == I_NUM) // Case numeric
-		{
-			ip++;
-			print_numeric_specified_columns(*ip | *(ip + 1) << BITS_IN_BYTE, 0);
-			ip += 2;
-			if (!nospaceb(*ip))
-				putchar(' ');
-		}
-		else if (*ip == I_VAR) // Case variable
-		{
-			ip++;
-			putchar(*ip++ + 'A');
-			if (!nospaceb(*ip))
-				putchar(' ');
-		}
-		else if (*ip == I_STR) // Case string
-		{
-			char c;
-
-			c = '\"';
-			ip++;
-			for (i = *ip; i; i--)
-				if (*(ip + i) == '\"')
-				{
-					c = '\'';
-					break;
-				}
-
-			putchar(c);
-			i = *ip++;
-			while (i--)
-			{
-				putchar(*ip++);
-			}
-			putchar(c);
-			if (*ip == I_VAR)
-				putchar(' ');
-		}
-
-		else // Nothing match, I think, such case is impossible
-		{
-			err = ERR_SYS;
-			return;
-		}
-	}
-}
+	struct batch_pool *pool; // pool
+	unsigned int index;		 // own queue index
+	pthread_t thread;		 // thread
+};
 
-// Get argument in parenthesis
-short get_argument_in_parenthesis()
+// Take a job from own queue or steal from another
+// Return job index, or job count if there is nothing left
+unsigned int batch_take_job(struct batch_pool *pool, unsigned int index)
 {
-	short value;
-
-	if (*current_icode != I_OPEN)
-	{
-		err = ERR_PAREN;
-		return 0;
-	}
-	current_icode++;
-	value = i_the_parser();
-	if (err)
-		return 0;
+	struct batch_queue *queue = &pool->queue[index];
+	struct batch_queue *victim;
+	unsigned int i, middle, end;
 
-	if (*current_icode != I_CLOSE)
+	pthread_mutex_lock(&queue->lock);
+	if (queue->next < queue->end)
 	{
-		err = ERR_PAREN;
-		return 0;
+		i = queue->next++;
+		pthread_mutex_unlock(&queue->lock);
+		return i;
 	}
-	current_icode++;
+	pthread_mutex_unlock(&queue->lock);
 
-	return value;
-}
-
-// Get value
-short i_get_value()
-{
-	short value;
-
-	switch (*current_icode)
+	for (i = 1; i < pool->thread_count; i++)
 	{
-	case I_NUM:
-		current_icode++;
-		value = *current_icode | *(current_icode + 1) << BITS_IN_BYTE;
-		current_icode += 2;
-		break;
-	case I_PLUS:
-		current_icode++;
-		value = i_get_value();
-		break;
-	case I_MINUS:
-		current_icode++;
-		value = 0 - i_get_value();
-		break;
-	case I_VAR:
-		current_icode++;
-		value = variable_area[*current_icode++];
-		break;
-	case I_OPEN:
-		value = get_argument_in_parenthesis();
-		break;
-	case I_ARRAY:
-		current_icode++;
-		value = get_argument_in_parenthesis();
-		if (err)
-			break;
-		if (value >= SIZE_ARRAY_AREA)
+		victim = &pool->queue[(index + i) % pool->thread_count];
+		pthread_mutex_lock(&victim->lock);
+		if (victim->next == victim->end)
 		{
-			err = ERR_SOR;
-			break;
-		}
-		value = array_area[value];
-		break;
-	case I_RND:
-		current_icode++;
-		value = get_argument_in_parenthesis();
-		if (err)
-			break;
-		value = get_random_number(value);
-		break;
-	case I_ABS:
-		current_icode++;
-		value = get_argument_in_parenthesis();
-		if (err)
-			break;
-		if (value < 0)
-			value *= -1;
-		break;
-	case I_SIZE:
-		current_icode++;
-		if ((*current_icode != I_OPEN) || (*(current_icode + 1) != I_CLOSE))
-		{
-			err = ERR_PAREN;
-			break;
+			pthread_mutex_unlock(&victim->lock);
+			continue;
 		}
-		current_icode += 2;
-		value = return_free_memory_size();
-		break;
+		middle = victim->next + (victim->end - victim->next) / 2; // upper half
+		end = victim->end;
+		victim->end = middle;
+		pthread_mutex_unlock(&victim->lock);
 
-	default:
-		err = ERR_SYNTAX;
-		break;
+		pthread_mutex_lock(&queue->lock);
+		queue->next = middle + 1;
+		queue->end = end;
+		pthread_mutex_unlock(&queue->lock);
+		return middle;
 	}
-	return value;
-}
-
-// multiply or divide calculation
-short i_multiply_or_divide_calculation()
-{
-	short value, tmp;
-
-	value = i_get_value();
-	if (err)
-		return -1;
-
-	while (1)
-		switch (*current_icode)
-		{
-		case I_MUL:
-			current_icode++;
-			tmp = i_get_value();
-			value *= tmp;
-			break;
-		case I_DIV:
-			current_icode++;
-			tmp = i_get_value();
-			if (tmp == 0)
-			{
-				err = ERR_DIVBY0;
-				return -1;
-			}
-			value /= tmp;
-			break;
-		default:
-			return value;
-		}
+	return pool->job_count;
 }
 
-// add or subtract calculation
-short i_add_or_subtract_calculation()
+// Job output goes to its stream
+void batch_output(void *user, const char *data, size_t len)
 {
-	short value, tmp;
-
-	value = i_multiply_or_divide_calculation();
-	if (err)
-		return -1;
-
-	while (1)
-		switch (*current_icode)
-		{
-		case I_PLUS:
-			current_icode++;
-			tmp = i_multiply_or_divide_calculation();
-			value += tmp;
-			break;
-		case I_MINUS:
-			current_icode++;
-			tmp = i_multiply_or_divide_calculation();
-			value -= tmp;
-			break;
-		default:
-			return value;
-		}
+	fwrite(data, 1, len, user);
 }
 
-// The parser
-short i_the_parser()
+// Jobs have no input
+size_t batch_input(void *user, char *data, size_t size)
 {
-	short value, tmp;
-
-	value = i_add_or_subtract_calculation();
-	if (err)
-		return -1;
-
-	// conditional expression
-	while (1)
-		switch (*current_icode)
-		{
-		case I_EQ:
-			current_icode++;
-			tmp = i_add_or_subtract_calculation();
-			value = (value == tmp);
-			break;
-		case I_SHARP:
-			current_icode++;
-			tmp = i_add_or_subtract_calculation();
-			value = (value != tmp);
-			break;
-		case I_LT:
-			current_icode++;
-			tmp = i_add_or_subtract_calculation();
-			value = (value < tmp);
-			break;
-		case I_LTE:
-			current_icode++;
-			tmp = i_add_or_subtract_calculation();
-			value = (value <= tmp);
-			break;
-		case I_GT:
-			current_icode++;
-			tmp = i_add_or_subtract_calculation();
-			value = (value > tmp);
-			break;
-		case I_GTE:
-			current_icode++;
-			tmp = i_add_or_subtract_calculation();
-			value = (value >= tmp);
-			break;
-		default:
-			return value;
-		}
+	(void)user;
+	(void)data;
+	(void)size;
+	return 0;
 }
 
-// PRINT handler
-void i_print_handler()
+// Run 1 job
+void batch_run_job(struct batch_pool *pool, struct batch_job *job)
 {
-	short value;
-	short len;
-	unsigned char i;
+	struct tb_options options;
+	tb_context *tb;
+	FILE *output_stream;
+	size_t stats_length;
 
-	len = 0;
-	while (*current_icode != I_SEMI && *current_icode != I_EOL)
+	job->status = 2;
+	output_stream = open_memstream(&job->output, &job->output_length);
+	if (!output_stream)
+		return;
+	options = *pool->options;
+	options.flush_policy = TB_FLUSH_BLOCK;
+	options.output = batch_output;
+	options.output_user = output_stream;
+	options.input = batch_input;
+	tb = tb_create(&options);
+	if (tb)
 	{
-		switch (*current_icode)
-		{
-		case I_STR:
-			current_icode++;
-			i = *current_icode++;
-			while (i--)
-				putchar(*current_icode++);
-			break;
-		case I_SHARP:
-			current_icode++;
-			len = i_the_parser();
-			if (err)
-				return;
-			break;
-		default:
-			value = i_the_parser();
-			if (err)
-				return;
-			print_numeric_specified_columns(value, len);
-			break;
-		}
-
-		if (*current_icode == I_COMMA)
+		job->status = basic_file(tb, job->file_name, pool->run);
+		if (pool->stats)
 		{
-			current_icode++;
-			if (*current_icode == I_SEMI || *current_icode == I_EOL)
-				return;
-		}
-		else
-		{
-			if (*current_icode != I_SEMI && *current_icode != I_EOL)
-			{
-				err = ERR_SYNTAX;
-				return;
-			}
+			stats_length = tb_write_stats(tb, NULL, 0) + 1;
+			job->stats = malloc(stats_length);
+			if (job->stats)
+				tb_write_stats(tb, job->stats, stats_length);
 		}
+		tb_destroy(tb);
 	}
-	newline();
+	fclose(output_stream);
 }
 
-// INPUT handler
-void i_input_handler()
+void *batch_thread_main(void *argument)
 {
-	short value;
-	short index;
-	unsigned char i;
-	unsigned char prompt;
+	struct batch_thread *thread = argument;
+	struct batch_pool *pool = thread->pool;
+	unsigned int i;
 
-	while (1)
+	while ((i = batch_take_job(pool, thread->index)) < pool->job_count)
 	{
-		prompt = 1;
-
-		if (*current_icode == I_STR)
-		{
-			current_icode++;
-			i = *current_icode++;
-			while (i--)
-				putchar(*current_icode++);
-			prompt = 0;
-		}
-
-		switch (*current_icode)
-		{
-		case I_VAR:
-			current_icode++;
-			if (prompt)
-			{
-				putchar(*current_icode + 'A');
-				putchar(':');
-			}
-			value = input_numeric_and_return_value();
-			if (err)
-				return;
-			variable_area[*current_icode++] = value;
-			break;
-		case I_ARRAY:
-			current_icode++;
-			index = get_argument_in_parenthesis();
-			if (err)
-				return;
-			if (index >= SIZE_ARRAY_AREA)
-			{
-				err = ERR_SOR;
-				return;
-			}
-			if (prompt)
-			{
-				c_puts("@(");
-				print_numeric_specified_columns(index, 0);
-				c_puts("):");
-			}
-			value = input_numeric_and_return_value();
-			if (err)
-				return;
-			array_area[index] = value;
-			break;
-		default:
-			err = ERR_SYNTAX;
-			return;
-		}
-
-		switch (*current_icode)
-		{
-		case I_COMMA:
-			current_icode++;
-			break;
-		case I_SEMI:
-		case I_EOL:
-			return;
-		default:
-			err = ERR_SYNTAX;
-			return;
-		}
+		batch_run_job(pool, &pool->job[i]);
+		pthread_mutex_lock(&pool->lock);
+		pool->job[i].done = 1;
+		pthread_cond_broadcast(&pool->job_done);
+		pthread_mutex_unlock(&pool->lock);
 	}
+	return NULL;
 }
 
-// Variable assignment handler
-void i_variable_assignment_handler()
+// Select source files
+int batch_file_filter(const struct dirent *entry)
 {
-	short value;
-	short index;
-
-	index = *current_icode++;
-	if (*current_icode != I_EQ)
-	{
-		err = ERR_VWOEQ;
-		return;
-	}
-	current_icode++;
-
-	value = i_the_parser();
-	if (err)
-		return;
+	size_t len = strlen(entry->d_name);
 
-	variable_area[index] = value;
+	return len > 4 && strcmp(entry->d_name + len - 4, ".bas") == 0;
 }
 
-// Array assignment handler
-void i_array_assignment_handler()
+// Write a JSON string
+void write_json_string(FILE *file, const char *text)
 {
-	short value;
-	short index;
+	putc('"', file);
+	for (; *text; text++)
+		if (*text == '"' || *text == '\\')
+			fprintf(file, "\\%c", *text);
+		else if ((unsigned char)*text < ' ')
+			fprintf(file, "\\u%04x", *text);
+		else
+			putc(*text, file);
+	putc('"', file);
+}
 
-	index = get_argument_in_parenthesis();
-	if (err)
-		return;
+int basic_batch(const char *directory_name, unsigned int thread_count,
+				const struct tb_options *options, unsigned char run,
+				const char *stats_file_name)
+{
+	FILE *stats_file = NULL;
+	struct dirent **entry;
+	struct batch_pool pool;
+	struct batch_thread *thread = NULL;
+	unsigned int i, started;
+	int count, status;
 
-	if (index >= SIZE_ARRAY_AREA)
+	memset(&pool, 0, sizeof(pool));
+	count = scandir(directory_name, &entry, batch_file_filter, alphasort);
+	if (count < 0)
 	{
-		err = ERR_SOR;
-		return;
+		perror(directory_name);
+		return 2;
 	}
-
-	if (*current_icode != I_EQ)
+	if (stats_file_name)
 	{
-		err = ERR_VWOEQ;
-		return;
+		stats_file = fopen(stats_file_name, "w");
+		if (!stats_file)
+		{
+			perror(stats_file_name);
+			goto fail;
+		}
+		fputs("[", stats_file);
 	}
-	current_icode++;
 
-	value = i_the_parser();
-	if (err)
-		return;
-
-	array_area[index] = value;
-}
-
-// LET handler
-void i_let_handler()
-{
-	switch (*current_icode)
+	pool.job_count = count;
+	pool.thread_count = thread_count;
+	pool.options = options;
+	pool.run = run;
+	pool.stats = stats_file != NULL;
+	pool.job = calloc(count ? count : 1, sizeof(*pool.job));
+	pool.queue = calloc(thread_count, sizeof(*pool.queue));
+	thread = calloc(thread_count, sizeof(*thread));
+	if (!pool.job || !pool.queue || !thread)
 	{
-	case I_VAR:
-		current_icode++;
-		i_variable_assignment_handler(); // Variable assignment
-		break;
-	case I_ARRAY:
-		current_icode++;
-		i_array_assignment_handler(); // Array assignment
-		break;
-	default:
-		err = ERR_LETWOV;
-		break;
+		fputs("ttbasic: out of memory\n", stderr);
+		goto fail;
 	}
-}
-
-// Execute a series of i-code
-unsigned char *i_execute_a_series_of_icode()
-{
-	short line_number;			 // line number
-	unsigned char *line_pointer; // temporary line pointer
-	short index, vto, vstep;	 // FOR-NEXT items
-	short condition;			 // IF condition
-
-	while (*current_icode != I_EOL)
+	for (i = 0; i < pool.job_count; i++)
 	{
-
-		if (c_kbhit()) // check keyin
-			if (getchar() == 27)
-			{ // ESC ?
-				err = ERR_ESC;
-				return NULL;
-			}
-
-		switch (*current_icode)
+		pool.job[i].file_name = malloc(strlen(directory_name) + strlen(entry[i]->d_name) + 2);
+		if (!pool.job[i].file_name)
 		{
-
-		case I_GOTO:
-			current_icode++;
-			line_number = i_the_parser(); // get line number
-			if (err)
-				break;
-			line_pointer = search_line_by_line_number(line_number); // search line
-			if (line_number != get_line_number_by_line_pointer(line_pointer))
-			{ // if not found
-				err = ERR_ULN;
-				break;
-			}
-
-			current_line = line_pointer;	  // update line pointer
-			current_icode = current_line + 3; // update i-code pointer
-			break;
-
-		case I_GOSUB:
-			current_icode++;
-			line_number = i_the_parser(); // get line number
-			if (err)
-				break;
-			line_pointer = search_line_by_line_number(line_number); // search line
-			if (line_number != get_line_number_by_line_pointer(line_pointer))
-			{ // if not found
-				err = ERR_ULN;
-				break;
-			}
-
-			// push pointers
-			if (gosub_stack_index >= SIZE_GOSUB_STACK - 2)
-			{ // stack overflow ?
-				err = ERR_GSTKOF;
-				break;
-			}
-			gosub_stack[gosub_stack_index++] = current_line;  // push line pointer
-			gosub_stack[gosub_stack_index++] = current_icode; // push i-code pointer
-
-			current_line = line_pointer;	  // update line pointer
-			current_icode = current_line + 3; // update i-code pointer
-			break;
-
-		case I_RETURN:
-			if (gosub_stack_index < 2)
-			{ // stack empty ?
-				err = ERR_GSTKUF;
-				break;
-			}
-			current_icode = gosub_stack[--gosub_stack_index]; // pop line pointer
-			current_line = gosub_stack[--gosub_stack_index];  // pop i-code pointer
-			break;
-
-		case I_FOR:
-			current_icode++;
-
-			if (*current_icode++ != I_VAR)
-			{ // no variable
-				err = ERR_FORWOV;
-				break;
-			}
-
-			index = *current_icode;			 // get variable index
-			i_variable_assignment_handler(); // variable_area = value
-			if (err)
-				break;
-
-			if (*current_icode == I_TO)
-			{
-				current_icode++;
-				vto = i_the_parser(); // get TO value
-			}
-			else
-			{
-				err = ERR_FORWOTO;
-				break;
-			}
-
-			if (*current_icode == I_STEP)
-			{
-				current_icode++;
-				vstep = i_the_parser(); // get STEP value
-			}
-			else
-				vstep = 1; // default STEP value
-
-			// overflow check
-			if (((vstep < 0) && (-32767 - vstep > vto)) ||
-				((vstep > 0) && (32767 - vstep < vto)))
-			{
-				err = ERR_VOF;
-				break;
-			}
-
-			// push pointers
-			if (for_stack_index >= SIZE_LSTK - 5)
-			{ // stack overflow ?
-				err = ERR_LSTKOF;
-				break;
-			}
-			for_stack[for_stack_index++] = current_line;					  // push line pointer
-			for_stack[for_stack_index++] = current_icode;					  // push i-code pointer
-																			  // Special thanks hardyboy
-			for_stack[for_stack_index++] = (unsigned char *)(uintptr_t)vto;   // push TO value
-			for_stack[for_stack_index++] = (unsigned char *)(uintptr_t)vstep; // push STEP value
-			for_stack[for_stack_index++] = (unsigned char *)(uintptr_t)index; // push variable index
-			break;
-
-		case I_NEXT:
-			current_icode++;
-
-			if (for_stack_index < 5)
-			{ // stack empty ?
-				err = ERR_LSTKUF;
-				break;
-			}
-
-			index = (short)(uintptr_t)for_stack[for_stack_index - 1]; // read variable index
-			if (*current_icode++ != I_VAR)
-			{ // no variable
-				err = ERR_NEXTWOV;
-				break;
-			}
-			if (*current_icode++ != index)
-			{ // not equal index
-				err = ERR_NEXTUM;
-				break;
-			}
-
-			vstep = (short)(uintptr_t)for_stack[for_stack_index - 2]; // read STEP value
-			variable_area[index] += vstep;							  // update loop counter
-			vto = (short)(uintptr_t)for_stack[for_stack_index - 3];   // read TO value
-
-			// loop end
-			if (((vstep < 0) && (variable_area[index] < vto)) ||
-				((vstep > 0) && (variable_area[index] > vto)))
-			{
-				for_stack_index -= 5; // resume stack
-				break;
-			}
-
-			// loop continue
-			current_icode = for_stack[for_stack_index - 4]; // read line pointer
-			current_line = for_stack[for_stack_index - 5];  // read i-code pointer
-			break;
-
-		case I_IF:
-			current_icode++;
-			condition = i_the_parser(); // get condition
-			if (err)
-			{
-				err = ERR_IFWOC;
-				break;
-			}
-			if (condition) // if true continue
-				break;
-			// If false, same as REM
-
-		case I_REM:
-			// Seek pointer to I_EOL
-			// No problem even if it points not realy end of line
-			while (*current_icode != I_EOL)
-				current_icode++; // seek end of line
-			break;
-
-		case I_STOP:
-			while (*current_line)
-				current_line += *current_line; // seek end
-			return current_line;
-
-		case I_VAR:
-			current_icode++;
-			i_variable_assignment_handler();
-			break;
-		case I_ARRAY:
-			current_icode++;
-			i_array_assignment_handler();
-			break;
-		case I_LET:
-			current_icode++;
-			i_let_handler();
-			break;
-		case I_PRINT:
-			current_icode++;
-			i_print_handler();
-			break;
-		case I_INPUT:
-			current_icode++;
-			i_input_handler();
-			break;
-
-		case I_SEMI:
-			current_icode++;
-			break;
-
-		case I_LIST:
-		case I_NEW:
-		case I_RUN:
-			err = ERR_COM;
-			break;
-
-		default:
-			err = ERR_SYNTAX;
-			break;
+			fputs("ttbasic: out of memory\n", stderr);
+			goto fail;
 		}
-
-		if (err)
-			return NULL;
+		sprintf(pool.job[i].file_name, "%s/%s", directory_name, entry[i]->d_name);
 	}
-	return current_line + *current_line;
-}
-
-// RUN command handler
-void i_run_command_handler()
-{
-	unsigned char *line_pointer;
-
-	gosub_stack_index = 0;
-	for_stack_index = 0;
-	current_line = list_area;
-
-	while (*current_line)
+	for (i = 0; i < (unsigned int)count; i++)
+		free(entry[i]);
+	free(entry);
+
+	// Share out the jobs in ranges
+	pthread_mutex_init(&pool.lock, NULL);
+	pthread_cond_init(&pool.job_done, NULL);
+	for (i = 0; i < thread_count; i++)
 	{
-		current_icode = current_line + 3;
-		line_pointer = i_execute_a_series_of_icode();
-		if (err)
-			return;
-		current_line = line_pointer;
+		pthread_mutex_init(&pool.queue[i].lock, NULL);
+		pool.queue[i].next = (unsigned long)pool.job_count * i / thread_count;
+		pool.queue[i].end = (unsigned long)pool.job_count * (i + 1) / thread_count;
 	}
-}
-
-// LIST command handler
-void i_list_handler()
-{
-	short line_number;
-
-	line_number = (*current_icode == I_NUM) ? get_line_number_by_line_pointer(current_icode) : 0;
-
-	for (current_line = list_area;
-		 *current_line && (get_line_number_by_line_pointer(current_line) < line_number);
-		 current_line += *current_line)
-		;
-
-	while (*current_line)
-	{
-		print_numeric_specified_columns(get_line_number_by_line_pointer(current_line), 0);
-		putchar(' ');
-		listing_1_line_of_icode(current_line + 3);
-		if (err)
-			break;
-		newline();
-		current_line += *current_line;
-	}
-}
-
-// NEW command handler
-void i_new_command_handler(void)
-{
-	unsigned char i;
-
-	for (i = 0; i < 26; i++)
-		variable_area[i] = 0;
-	for (i = 0; i < SIZE_ARRAY_AREA; i++)
-		array_area[i] = 0;
-	gosub_stack_index = 0;
-	for_stack_index = 0;
-	*list_area = 0;
-	current_line = list_area;
-}
-
-// Command processor
-void i_command_processor()
-{
-	current_icode = icode_conversion_buffer;
-	switch (*current_icode)
+	for (started = 0; started < thread_count; started++)
 	{
-	case I_NEW:
-		current_icode++;
-		if (*current_icode == I_EOL)
-			i_new_command_handler();
-		else
-			err = ERR_SYNTAX;
-		break;
-	case I_LIST:
-		current_icode++;
-		if (*current_icode == I_EOL || *(current_icode + 3) == I_EOL)
-			i_list_handler();
-		else
-			err = ERR_SYNTAX;
-		break;
-	case I_RUN:
-		current_icode++;
-		i_run_command_handler();
-		break;
-	default:
-		i_execute_a_series_of_icode();
-		break;
+		thread[started].pool = &pool;
+		thread[started].index = started;
+		if (pthread_create(&thread[started].thread, NULL, batch_thread_main, &thread[started]))
+			break; // the others steal its jobs
 	}
-}
+	if (!started)
+		batch_thread_main(&thread[0]); // run here
 
-// Print OK or error message
-void error()
-{
-	if (err)
+	// Write the results in order as they finish
+	status = 0;
+	for (i = 0; i < pool.job_count; i++)
 	{
-		if (current_icode >= list_area && current_icode < list_area + SIZE_LIST_BUFFER && *current_line)
+		pthread_mutex_lock(&pool.lock);
+		while (!pool.job[i].done)
+			pthread_cond_wait(&pool.job_done, &pool.lock);
+		pthread_mutex_unlock(&pool.lock);
+
+		fwrite(pool.job[i].output, 1, pool.job[i].output_length, stdout);
+		fflush(stdout);
+		fprintf(stderr, "%s: %d\n", pool.job[i].file_name, pool.job[i].status);
+		if (pool.job[i].status > status)
+			status = pool.job[i].status;
+		if (stats_file)
 		{
-			newline();
-			c_puts("LINE:");
-			print_numeric_specified_columns(get_line_number_by_line_pointer(current_line), 0);
-			putchar(' ');
-			listing_1_line_of_icode(current_line + 3);
-		}
-		else
-		{
-			newline();
-			c_puts("YOU TYPE: ");
-			c_puts(command_line_buffer);
-		}
+			fputs(i ? ",\n {\"file\": " : "\n {\"file\": ", stats_file);
+			write_json_string(stats_file, pool.job[i].file_name);
+			fprintf(stats_file, ", \"status\": %d, \"stats\": %s}", pool.job[i].status,
+					pool.job[i].stats ? pool.job[i].stats : "null");
+		}
+		free(pool.job[i].stats);
+		free(pool.job[i].output);
+		free(pool.job[i].file_name);
 	}
 
-	newline();
-	c_puts(errmsg[err]);
-	newline();
-	err = 0;
-}
-
-/*
-TOYOSHIKI Tiny BASIC
-The BASIC entry point
-*/
-void basic()
-{
-	unsigned char len;
-
-	i_new_command_handler();
-	c_puts("TOYOSHIKI TINY BASIC");
-	newline();
-	c_puts(STR_EDITION);
-	c_puts(" EDITION");
-	newline();
-	error(); // Print OK, and Clear error flag
-
-	// Input 1 line and execute
-	while (1)
+	for (i = 0; i < started; i++)
+		pthread_join(thread[i].thread, NULL);
+	for (i = 0; i < thread_count; i++)
+		pthread_mutex_destroy(&pool.queue[i].lock);
+	pthread_mutex_destroy(&pool.lock);
+	pthread_cond_destroy(&pool.job_done);
+	free(thread);
+	free(pool.queue);
+	free(pool.job);
+	if (stats_file)
 	{
-		putchar('>');					// Prompt
-		c_gets();						// Input 1 line
-		len = convert_token_to_icode(); // Convert token to i-code
-		if (err)
-		{ // Error
-			error();
-			continue; // Do nothing
-		}
-
-		// Quit if i-code is "SYSTEM"
-		if (*icode_conversion_buffer == I_SYSTEM)
+		fputs("\n]\n", stats_file);
+		if (fclose(stats_file))
 		{
-			return;
+			perror(stats_file_name);
+			return 2;
 		}
-
-		// If the line starts with a number, store i-code in list
-		if (*icode_conversion_buffer == I_NUM)
-		{											  // Case the top includes line number
-			*icode_conversion_buffer = len;			  // Change I_NUM to byte length
-			insert_icode_to_the_list_preconditions(); // Insert list
-			if (err)								  // Error
-				error();							  // Print error message
-			continue;
-		}
-
-		// Simply execude the code in the the entered statement
-		i_command_processor(); // Execute direct
-		error();			   // Print OK, and Clear error flag
 	}
+	return status;
+
+fail: // before any job started
+	for (i = 0; pool.job && i < pool.job_count; i++)
+		free(pool.job[i].file_name);
+	for (i = 0; i < (unsigned int)count; i++)
+		free(entry[i]);
+	free(entry);
+	free(thread);
+	free(pool.queue);
+	free(pool.job);
+	if (stats_file)
+		fclose(stats_file);
+	return 2;
 }
@@ -0,0 +1,156 @@
+/*
+	TOYOSHIKI Tiny BASIC for Linux
+	(C)2015 Tetsuya Suzuki
+	Interpreter library interface
+*/
+
+#ifndef TTBASIC_H
+#define TTBASIC_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Exported from the shared library
+#if defined(__GNUC__)
+#define TB_API __attribute__((visibility("default")))
+#else
+#define TB_API
+#endif
+
+// Output flush policy
+enum
+{
+	TB_FLUSH_AUTO,	// LINE to standard output on a terminal, BLOCK otherwise
+	TB_FLUSH_LINE,	// Flush at every newline
+	TB_FLUSH_BLOCK, // Flush when the buffer is full
+};
+
+// Execution engine
+enum
+{
+	TB_ENGINE_ICODE,	// Evaluate expressions from i-code
+	TB_ENGINE_BYTECODE, // Evaluate expressions from cached bytecode
+};
+
+// Result of loading and running
+enum
+{
+	TB_OK,		// Done
+	TB_ERROR,	// Stopped by an error, the message is in the output
+	TB_RUNNING, // tb_step stopped after n statements, call it again to go on
+	TB_SYSTEM,	// SYSTEM command
+};
+
+#define TB_ARRAY_MAX 32768 // Array size at most (index is a numeric)
+
+// Output callback
+// Receives len bytes of output at data, whenever the output buffer is flushed
+typedef void (*tb_output_callback)(void *user, const char *data, size_t len);
+
+// Input callback
+// Puts at most size bytes of input at data and returns the count,
+// or 0 at the end of input
+typedef size_t (*tb_input_callback)(void *user, char *data, size_t size);
+
+// Interpreter options
+// Zero for every member is the default
+// With sample_file_name, the first run sets a process-wide SIGPROF
+// handler. SIGPROF not raised by the sampler is passed to the handler set
+// before it, so a host's own profiler goes on working, but a handler the
+// host sets later replaces the sampler's.
+struct tb_options
+{
+	unsigned char engine;		  // TB_ENGINE_ICODE or TB_ENGINE_BYTECODE
+	unsigned char flush_policy;	  // TB_FLUSH_AUTO, TB_FLUSH_LINE or TB_FLUSH_BLOCK
+	long array_size;			  // @() elements, 0 for 64
+	const char *array_file_name;  // File to map @() from, or NULL
+	tb_output_callback output;	  // Output, or NULL for standard output
+	void *output_user;			  // Passed to output
+	tb_input_callback input;	  // Input, or NULL for standard input
+	void *input_user;			  // Passed to input
+	unsigned char perf_counters;  // Report hardware counters after every run
+	const char *sample_file_name; // Write folded stacks sampled in runs, or NULL
+	long sample_interval;		  // Sampling interval in microseconds, 0 for 1000
+	const char *trace_file_name;  // Write the TRON trace after every run, or NULL
+};
+
+typedef struct tb_context tb_context; // Interpreter
+
+// Create an interpreter with an empty program
+// options may be NULL for defaults
+// Return NULL if there is no memory, the array size is too large or the
+// array file can't be mapped (errno tells)
+TB_API tb_context *tb_create(const struct tb_options *options);
+
+// Destroy an interpreter, after flushing its output
+TB_API void tb_destroy(tb_context *tb);
+
+// Load source text
+// Lines are read as ttbasic reads a file: numbered lines are stored and
+// the others are executed. Stops at the first error or SYSTEM, with
+// the numbered lines read before it stored.
+// Return TB_OK, TB_ERROR or TB_SYSTEM
+TB_API int tb_load_source(tb_context *tb, const char *text, size_t len);
+
+// Save the stored program as an image
+// Writes at most size bytes to image
+// Return the image size, which may be larger than size
+TB_API size_t tb_save_image(tb_context *tb, void *image, size_t size);
+
+// Load an image made by tb_save_image, replacing the program
+// Return TB_OK, or TB_ERROR if the image is broken or too large
+TB_API int tb_load_image(tb_context *tb, const void *image, size_t len);
+
+// Save the stored program to a file as an image
+// Return TB_OK, or TB_ERROR with errno if the file can't be written
+TB_API int tb_save_image_file(tb_context *tb, const char *file_name);
+
+// Load an image file made by tb_save_image_file or tb_save_image,
+// replacing the program. The file is mapped, not read line by line.
+// Return TB_OK, or TB_ERROR with errno, EINVAL if the image is broken or
+// too large
+TB_API int tb_load_image_file(tb_context *tb, const char *file_name);
+
+// Run the program from the first line to the end
+// Return TB_OK or TB_ERROR
+TB_API int tb_run(tb_context *tb);
+
+// Run at most n statements of the program
+// Starts from the first line, or goes on where the last call stopped
+// Return TB_RUNNING if n statements ran and the program is not over,
+// otherwise as tb_run
+TB_API int tb_step(tb_context *tb, unsigned long n);
+
+// Return the number of statements run since tb_create
+// The ; between statements is not one
+TB_API unsigned long tb_statement_count(tb_context *tb);
+
+// Write the counters since tb_create as a JSON object: statements,
+// dispatch (statements dispatched by keyword), line_searches, line_probes
+// (line index entries compared by the searches), expressions, and the
+// high-water marks gosub_depth_high, for_depth_high and list_bytes_high
+// Writes at most size bytes with the NULL, as snprintf
+// Return the text length, which may be size or more
+TB_API size_t tb_write_stats(tb_context *tb, char *text, size_t size);
+
+// Get or set variable A to Z
+// tb_set_var returns TB_ERROR if the name is not a variable
+TB_API short tb_get_var(tb_context *tb, char name);
+TB_API int tb_set_var(tb_context *tb, char name, short value);
+
+// Interact with the user: banner, prompt, and commands until SYSTEM or
+// the end of input
+TB_API void tb_repl(tb_context *tb);
+
+// Let [ESC] typed on the terminal abort a running program
+// For the whole process, call once
+TB_API void tb_watch_escape(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif